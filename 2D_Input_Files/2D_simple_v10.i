@@ -66,11 +66,6 @@
 		family = MONOMIAL
 		block = pellets
 	[../]
-	[./k_pellets_dT] 
-		order = FIRST 
-		family = MONOMIAL
-		block = pellets
-	[../]
 	[./k_sheath] 
 		order = FIRST 
 		family = MONOMIAL
@@ -144,14 +139,6 @@
 		execute_on = timestep_begin
 		model_k = true
 	[../]
-	[./k_pellets_dT_aux] ##solves for burnup auxvariable
-		type = ThermalConductivity_dTPelletsAux
-		variable = k_pellets_dT
-		temp = temp
-		burnup = burnup
-		execute_on = timestep_begin
-		model_k_dT = true
-	[../]
 	[./k_sheath_aux] ##solves for burnup auxvariable
 		type = ThermalConductivitySheathAux
 		variable = k_sheath
@@ -292,8 +279,6 @@
 		burnup = burnup
 		burnup_dt = burnup_dt
 		densification_fraction = densification_fraction
-		k_pellets = k_pellets
-		k_pellets_dT = k_pellets_dT
 		block = pellets
 		initial_porosity = 0.0286
 		model_thermal_conductivity = true
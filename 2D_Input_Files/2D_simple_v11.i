@@ -74,11 +74,6 @@
 		family = MONOMIAL
 		block = pellets
 	[../]
-	[./k_pellets_dT] ##solves for the local burnup_dt
-		order = FIRST 
-		family = MONOMIAL
-		block = pellets
-	[../]
 	[./k_sheath] ##solves for the local burnup - used everywhere except FissionHeatMaterial
 		order = FIRST 
 		family = MONOMIAL
@@ -158,14 +153,6 @@
 		execute_on = residual
 		model_k = true
 	[../]
-	[./k_pellets_dT_aux] ##solves for burnup auxvariable
-		type = ThermalConductivity_dTPelletsAux
-		variable = k_pellets_dT
-		temp = temp
-		burnup = burnup
-		execute_on = residual
-		model_k_dT = true
-	[../]
 	[./k_sheath_aux] ##solves for burnup auxvariable
 		type = ThermalConductivitySheathAux
 		variable = k_sheath
@@ -306,8 +293,6 @@
 		burnup = burnup
 		burnup_dt = burnup_dt
 		densification_fraction = densification_fraction
-		k_pellets = k_pellets
-		k_pellets_dT = k_pellets_dT
 		block = pellets
 		initial_porosity = 0.0286
 		model_thermal_conductivity = true
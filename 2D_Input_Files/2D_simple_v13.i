@@ -61,11 +61,6 @@
 		family = MONOMIAL
 		block = pellets
 	[../]
-	[./k_pellets_dT] ##solves for the local burnup_dt
-		order = FIRST 
-		family = MONOMIAL
-		block = pellets
-	[../]
 	[./k_sheath] ##solves for the local burnup - used everywhere except FissionHeatMaterial
 		order = FIRST 
 		family = MONOMIAL
@@ -81,6 +76,11 @@
 		family = MONOMIAL
 		block = pellets
 	[../]
+	[./gap_conductance] ##the gap_conductance material property, sampled by fuel_performance at the pellet surface
+		order = CONSTANT
+		family = MONOMIAL
+		block = pellets
+	[../]
 []
 
 ##Variables to be solved for in the differential equations (ODE/PDE) in the Kernels
@@ -93,10 +93,6 @@
   [../]
   [./disp_y] ##y-displacement variable
   [../]
-	[./densification_fraction] ##densification fraction variable - a percentage less than 60%
-		initial_condition = 0
-		block = pellets
-	[../]
 []
 
 ##Solve for the AuxVariables - these do not solve ODE/PDE
@@ -124,7 +120,6 @@
 	[./vstrain_aux] ##solves for burnup auxvariable
 		type = VStrainAux
 		variable = vstrain
-		densification_fraction = densification_fraction
 		execute_on = residual
 		initial_porosity = 0.0286
 		model_vstrain = true
@@ -137,14 +132,6 @@
 		execute_on = residual
 		model_k = true
 	[../]
-	[./k_pellets_dT_aux] ##solves for burnup auxvariable
-		type = ThermalConductivity_dTPelletsAux
-		variable = k_pellets_dT
-		temp = temp
-		burnup = burnup
-		execute_on = residual
-		model_k_dT = true
-	[../]
 	[./k_sheath_aux] ##solves for burnup auxvariable
 		type = ThermalConductivitySheathAux
 		variable = k_sheath
@@ -173,34 +160,29 @@
 		model_SFP = false
 		model_GFP = false
 	[../]
+	[./gap_conductance_aux] ##copies the gap_conductance of GapHeatConductance once per step
+		type = MaterialRealAux
+		variable = gap_conductance
+		property = gap_conductance
+		execute_on = timestep
+	[../]
 []
 
 ##Solve for the Variables
 [Kernels]
-	[./HC] ##solves for the thermal conductivity - couples to Heat_dt, HeatSource and Densification_Fraction
+	[./HC] ##solves for the thermal conductivity - couples to Heat_dt and HeatSource
 		type = HeatConduction
 		variable = temp
 	[../]
-	[./Heat_dt] ##solves for the time rate of change of the thermal conductivity - couples to HC, HeatSource and Densification_Fraction
+	[./Heat_dt] ##solves for the time rate of change of the thermal conductivity - couples to HC and HeatSource
 		type = HeatConductionTimeDerivative
 		variable = temp
 	[../]
-	[./HeatSource] ##solves for the temperature of the pellet given the heat produced from nuclear fission (uses the FissionHeatMaterial) - couples to HC, Heat_dt and Densification_Fraction
+	[./HeatSource] ##solves for the temperature of the pellet given the heat produced from nuclear fission (uses the FissionHeatMaterial) - couples to HC and Heat_dt
 		type = FissionHeatKernel
 		variable = temp
 		block = pellets
 	[../]
-	[./Densification_Fraction_RHS] ##solves for F_porosity - couples to Denisification_Fraction_LHS
-		type = DensificationFractionKernel
-		variable = densification_fraction ##this is a decimal value
-		temp = temp
-		burnup_dt = burnup_dt
-		model_densification_fraction = true
-	[../]
-	[./Densification_Fraction_LHS] ##solves for F_porosity - couples to Denisification_Fraction_RHS
-		type = TimeDerivative
-		variable = densification_fraction ##this is a decimal value
-	[../]
 []
 
 ##Allows for solid mechanics to be used
@@ -278,14 +260,17 @@
 
 
 [Materials]
+	[./Densification] ##Integrates the densification fraction at each quadrature point, read by HCM_Pellet and vstrain_aux
+		type = DensificationMaterial
+		block = pellets
+		temp = temp
+		burnup_dt = burnup_dt
+	[../]
 	[./HCM_Pellet] ##Determines the thermal properties of the pellet - thermal conductivity, specific heat, porosity. If these models are set to false, then default values of 1 are given
     type = PelletThermalMaterial
 		temp = temp
 		burnup = burnup
 		burnup_dt = burnup_dt
-		densification_fraction = densification_fraction
-		k_pellets = k_pellets
-		k_pellets_dT = k_pellets_dT
 		block = pellets
 		initial_porosity = 0.0286
 		model_thermal_conductivity = true
@@ -401,10 +386,29 @@
 		max_increment = 3e-6
 		type = MaxIncrement
 	[../]
-	[./MaxIncrementDensificationF]
-		variable = densification_fraction
-		max_increment = 1e-2
-		type = MaxIncrement
+[]
+
+
+[UserObjects]
+	[./fuel_performance] ##Metrics every step and radial profiles every 10 steps, so the exodus output can be sparse (Outputs/exodus/interval)
+		type = FuelPerformanceReporter
+		file_base = 2D_Paraview/2D_simple_v13_metrics
+		disp_r = disp_x
+		pellet_radius = 6e-3
+		sheath_inner_radius = 6.045e-3
+		sheath_outer_radius = 6.465e-3
+		axial_position = 8.25e-3
+		gap_conductance = gap_conductance
+		profiles = radial
+		profile_start = '0 8.25e-3 0'
+		profile_end = '6.465e-3 8.25e-3 0'
+		profile_points = 30
+		profile_variables = 'temp disp_x'
+		profile_interval = 10
+	[../]
+	[./diagnostics] ##Writes the values recorded by the materials with display_values = true
+		type = DiagnosticsWriter
+		file_base = 2D_Paraview/2D_simple_v13_diagnostics
 	[../]
 []
 
@@ -454,9 +458,12 @@
 [Outputs]
   file_base = 2D_Paraview/2D_simple_v13_out
   output_initial = true
-  exodus = true
   print_linear_residuals = true
   print_perf_log = true
+  [./exodus] ##full fields every 10 steps, fuel_performance writes the metrics every step
+    type = Exodus
+    interval = 10
+  [../]
 []
 
 
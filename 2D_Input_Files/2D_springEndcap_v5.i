@@ -72,11 +72,6 @@
 		family = MONOMIAL
 		block = pellets
 	[../]
-	[./k_pellets_dT] ##solves for the local burnup_dt
-		order = FIRST 
-		family = MONOMIAL
-		block = pellets
-	[../]
 	[./k_sheath] ##solves for the local burnup - used everywhere except FissionHeatMaterial
 		order = FIRST 
 		family = MONOMIAL
@@ -104,10 +99,6 @@
   [../]
   [./disp_y] ##y-displacement variable
   [../]
-	[./densification_fraction] ##densification fraction variable - a percentage less than 60%
-		block = pellets
-		initial_condition = 0
-	[../]
 []
 
 ##Solve for the AuxVariables - these do not solve ODE/PDE
@@ -137,7 +128,6 @@
 	[./vstrain_aux] ##solves for burnup auxvariable
 		type = VStrainAux
 		variable = vstrain
-		densification_fraction = densification_fraction
 		initial_porosity = 0.0286
 		execute_on = residual
 		model_vstrain = true
@@ -150,14 +140,6 @@
 		execute_on = residual
 		model_k = true
 	[../]
-	[./k_pellets_dT_aux] ##solves for burnup auxvariable
-		type = ThermalConductivity_dTPelletsAux
-		variable = k_pellets_dT
-		temp = temp
-		burnup = burnup
-		execute_on = residual
-		model_k_dT = true
-	[../]
 	[./k_sheath_aux] ##solves for burnup auxvariable
 		type = ThermalConductivitySheathAux
 		variable = k_sheath
@@ -190,30 +172,19 @@
 
 ##Solve for the Variables
 [Kernels]
-	[./HC] ##solves for the thermal conductivity - couples to Heat_dt, HeatSource and Densification_Fraction
+	[./HC] ##solves for the thermal conductivity - couples to Heat_dt and HeatSource
 		type = HeatConduction
 		variable = temp
 	[../]
-	[./Heat_dt] ##solves for the time rate of change of the thermal conductivity - couples to HC, HeatSource and Densification_Fraction
+	[./Heat_dt] ##solves for the time rate of change of the thermal conductivity - couples to HC and HeatSource
 		type = HeatConductionTimeDerivative
 		variable = temp
 	[../]
-	[./HeatSource] ##solves for the temperature of the pellet given the heat produced from nuclear fission (uses the FissionHeatMaterial) - couples to HC, Heat_dt and Densification_Fraction
+	[./HeatSource] ##solves for the temperature of the pellet given the heat produced from nuclear fission (uses the FissionHeatMaterial) - couples to HC and Heat_dt
 		type = FissionHeatKernel
 		variable = temp
 		block = pellets
 	[../]
-	[./Densification_Fraction_RHS] ##solves for F_porosity - couples to Denisification_Fraction_LHS
-		type = DensificationFractionKernel
-		variable = densification_fraction
-		temp =temp
-		burnup_dt = burnup_dt
-		model_densification_fraction = true
-	[../]
-	[./Densification_Fraction_LHS] ##solves for F_porosity - couples to Denisification_Fraction_RHS
-		type = TimeDerivative
-		variable = densification_fraction
-	[../]
 []
 
 ##Allows for solid mechanics to be used
@@ -318,14 +289,17 @@
 
 
 [Materials]
+	[./Densification] ##Integrates the densification fraction at each quadrature point, read by HCM_Pellet and vstrain_aux
+		type = DensificationMaterial
+		block = pellets
+		temp = temp
+		burnup_dt = burnup_dt
+	[../]
 	[./HCM_Pellet] ##Determines the thermal properties of the pellet - thermal conductivity, specific heat, porosity. If these models are set to false, then default values of 1 are given
     type = PelletThermalMaterial
 		temp = temp
 		burnup = burnup
 		burnup_dt = burnup_dt
-		densification_fraction = densification_fraction
-		k_pellets = k_pellets
-		k_pellets_dT = k_pellets_dT
 		block = pellets
 		initial_porosity = 0.0286
 		model_thermal_conductivity = true
@@ -471,10 +445,35 @@
 		max_increment = 3e-6
 		type = MaxIncrement
 	[../]
-	[./MaxIncrementDensificationF]
-		variable = densification_fraction
-		max_increment = 1e-2
-		type = MaxIncrement
+[]
+
+
+##Preconditioning - the diagonal blocks of the Jacobian by default, the field split is selected with Preconditioning/active=split
+[Preconditioning]
+	active = 'SMP'
+	[./SMP] ##the variable diagonal blocks, as without a Preconditioning block
+		type = SMP
+		full = false
+	[../]
+	[./split] ##Field split: temperature and displacements each get their own preconditioner, see scripts/preconditioner_benchmark.py
+		##The Executioner's -pc_type has to be dropped with it: Executioner/petsc_options_iname=-ksp_gmres_restart Executioner/petsc_options_value=201
+		type = FSP
+		full = true
+		topsplit = fields
+		[./fields] ##multiplicative: each block is solved with the updates of the ones before it, which carries the thermal-mechanical coupling
+			splitting = 'thermal mechanical'
+			splitting_type = multiplicative
+		[../]
+		[./thermal]
+			vars = temp
+			petsc_options_iname = '-ksp_type -pc_type -pc_hypre_type'
+			petsc_options_value = 'preonly hypre boomeramg'
+		[../]
+		[./mechanical] ##elasticity, with the contact constraints, needs a higher strong threshold than the default 0.25
+			vars = 'disp_x disp_y'
+			petsc_options_iname = '-ksp_type -pc_type -pc_hypre_type -pc_hypre_boomeramg_strong_threshold'
+			petsc_options_value = 'preonly hypre boomeramg 0.7'
+		[../]
 	[../]
 []
 
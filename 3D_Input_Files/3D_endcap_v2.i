@@ -12,9 +12,16 @@
 	#disp_y = disp_y
 []
 
-##Trelis geometry
+##Generated geometry with the sidesets of the Trelis mesh (file = 3D_Geometries/3D_endcapcoarse.e)
 [Mesh]
-	file = 3D_Geometries/3D_endcapcoarse.e
+	type = PelletStackMesh
+	dim = 3
+	pellet_count = 2
+	endcap = bottom
+	pellet_radial_elems = 6
+	pellet_radial_bias = 0.5
+	pellet_axial_elems = 6
+	azimuthal_elems = 8
 	displacements = 'disp_x disp_y disp_z'
 	patch_size = 1000
 []
@@ -55,6 +62,11 @@
 		family = MONOMIAL
 		block = pellets
 	[../]
+	[./densification_fraction] ##DensificationMaterial's densification fraction for Strain_Pellet, which couples a variable
+		order = CONSTANT
+		family = MONOMIAL
+		block = pellets
+	[../]
 []
 
 ##Variables to be solved for in the differential equations (ODE/PDE) in the Kernels
@@ -69,14 +81,16 @@
   [../]
   [./disp_z] ##z-displacement variable
   [../]
-	[./densification_fraction] ##densification fraction variable - a percentage less than 60%
-		block = pellets
-		initial_condition = 0
-	[../]
 []
 
 ##Solve for the AuxVariables - these do not solve ODE/PDE
 [AuxKernels]
+	[./densification_fraction_aux] ##copies the densification fraction of the Densification material
+		type = MaterialRealAux
+		variable = densification_fraction
+		property = densification_fraction
+		block = pellets
+	[../]
 	[./avg_burnup_aux] ##solves for avg_burnup auxvariable
 		type = AverageBurnupAux
 		variable = avg_burnup
@@ -110,30 +124,19 @@
 
 ##Solve for the Variables
 [Kernels]
-	[./HC] ##solves for the thermal conductivity - couples to Heat_dt, HeatSource and Densification_Fraction
+	[./HC] ##solves for the thermal conductivity - couples to Heat_dt and HeatSource
 		type = HeatConduction
 		variable = temp
 	[../]
-	[./Heat_dt] ##solves for the time rate of change of the thermal conductivity - couples to HC, HeatSource and Densification_Fraction
+	[./Heat_dt] ##solves for the time rate of change of the thermal conductivity - couples to HC and HeatSource
 		type = HeatConductionTimeDerivative		
 		variable = temp
 	[../]
-	[./HeatSource] ##solves for the temperature of the pellet given the heat produced from nuclear fission (uses the FissionHeatMaterial) - couples to HC, Heat_dt and Densification_Fraction
+	[./HeatSource] ##solves for the temperature of the pellet given the heat produced from nuclear fission (uses the FissionHeatMaterial) - couples to HC and Heat_dt
 		type = FissionHeatKernel
 		variable = temp
 		block = pellets
 	[../]
-	[./Densification_Fraction_RHS] ##solves for F_porosity - couples to Denisification_Fraction_LHS
-		type = DensificationFractionKernel
-		variable = densification_fraction
-		temp =temp
-		burnup_dt = burnup_dt
-		model_densification_fraction = true
-	[../]
-	[./Densification_Fraction_LHS] ##solves for F_porosity - couples to Denisification_Fraction_RHS
-		type = TimeDerivative
-		variable = densification_fraction
-	[../]
 []
 
 ##Allows for solid mechanics to be used
@@ -209,6 +212,7 @@
 #[]
 
 ##Allows heat to transfer over the gap between the pellet-sheath, pellet-endcap, and sheath-endcap
+##The penetration search behind it is MOOSE's own and searches every gap node on each update. MOOSE builds the locators itself, so skipping unmoved nodes needs a hook there
 [ThermalContact]
   [./pellet_to_sheath]
 		type = GapHeatTransfer
@@ -236,11 +240,16 @@
 
 
 [Materials]
+	[./Densification] ##Integrates the densification fraction at each quadrature point, read by HCM_Pellet and densification_fraction_aux
+		type = DensificationMaterial
+		block = pellets
+		temp = temp
+		burnup_dt = burnup_dt
+	[../]
 	[./HCM_Pellet] ##Determines the thermal properties of the pellet - thermal conductivity, specific heat, porosity. If these models are set to false, then default values of 1 are given
     type = PelletThermalMaterial
 		temp = temp
 		burnup = burnup
-		densification_fraction = densification_fraction
 		block = pellets
 		initial_temp = 300
 		initial_porosity = 0.0286
@@ -372,18 +381,34 @@
 		max_increment = 3e-6
 		type = MaxIncrement
 	[../]
-	[./MaxIncrementDensificationF]
-		variable = densification_fraction
-		max_increment = 1e-2
-		type = MaxIncrement
-	[../]
 []
 
 [Preconditioning]
+	active = 'SMP'
   [./SMP]
     type = SMP
    full = true
   [../]
+	[./split] ##Field split: temperature and displacements each get their own preconditioner, see scripts/preconditioner_benchmark.py
+		##The Executioner's -pc_type has to be dropped with it: Executioner/petsc_options_iname=-ksp_gmres_restart Executioner/petsc_options_value=201
+		type = FSP
+		full = true
+		topsplit = fields
+		[./fields] ##multiplicative: each block is solved with the updates of the ones before it, which carries the thermal-mechanical coupling
+			splitting = 'thermal mechanical'
+			splitting_type = multiplicative
+		[../]
+		[./thermal]
+			vars = temp
+			petsc_options_iname = '-ksp_type -pc_type -pc_hypre_type'
+			petsc_options_value = 'preonly hypre boomeramg'
+		[../]
+		[./mechanical] ##elasticity, with the contact constraints, needs a higher strong threshold than the default 0.25
+			vars = 'disp_x disp_y disp_z'
+			petsc_options_iname = '-ksp_type -pc_type -pc_hypre_type -pc_hypre_boomeramg_strong_threshold'
+			petsc_options_value = 'preonly hypre boomeramg 0.7'
+		[../]
+	[../]
 []
 
 [Executioner]
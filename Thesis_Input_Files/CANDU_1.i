@@ -64,11 +64,6 @@
     family = MONOMIAL
     block = pellet
   [../]
-  [./k_pellets_dT]
-    order = FIRST
-    family = MONOMIAL
-    block = pellet
-  [../]
   [./k_sheath]
     order = FIRST
     family = MONOMIAL
@@ -98,40 +93,34 @@
   [../]
   [./disp_z] ##z-displacement variable
   [../]
-  [./densification_fraction] ##densification fraction variable - a percentage less than 60%
-    initial_condition = 0
-    block = pellet
-  [../]
 [] ##Variables
 
 ##Solve for the AuxVariables - these do not solve ODE/PDE
 [AuxKernels]
-  [./avg_burnup_aux] ##solves for avg_burnup auxvariable
-    type = AverageBurnupAux
+  [./avg_burnup_aux] ##copies the pellet average burnup from burnup_uo
+    type = BurnupFieldAux
     variable = avg_burnup
-    initial_density = 1.065e4
+    burnup_object = burnup_uo
+    quantity = average_burnup
     execute_on = timestep_begin
-    model_wrt_time = true
-    linear_power_time = linear_power_function_time
-    model_wrt_burnup = false
-    linear_power_burnup = linear_power_function_burnup
   [../]
-  [./burnup_aux] ##solves for burnup auxvariable
-    type = BurnupAux
+  [./burnup_aux] ##copies the local burnup from burnup_uo
+    type = BurnupFieldAux
     variable = burnup
+    burnup_object = burnup_uo
+    quantity = burnup
     execute_on = timestep_begin
-    model_burnup = true
   [../]
-  [./burnup_dt_aux] ##solves for burnup auxvariable
-    type = Burnup_dtAux
+  [./burnup_dt_aux] ##copies the local burnup rate from burnup_uo
+    type = BurnupFieldAux
     variable = burnup_dt
+    burnup_object = burnup_uo
+    quantity = burnup_dt
     execute_on = timestep_begin
-    model_burnup_dt = true
   [../]
   [./vstrain_aux] ##solves for burnup auxvariable
     type = VStrainAux
     variable = vstrain
-    densification_fraction = densification_fraction
     execute_on = timestep_begin
     initial_porosity = 0.0286
     model_vstrain = true
@@ -144,14 +133,6 @@
     execute_on = timestep_begin
     model_k = true
   [../]
-  [./k_pellets_dT_aux] ##solves for burnup auxvariable
-    type = ThermalConductivity_dTPelletsAux
-    variable = k_pellets_dT
-    temp = temp
-    burnup = burnup
-    execute_on = timestep_begin
-    model_k_dT = true
-  [../]
   [./k_sheath_aux] ##solves for burnup auxvariable
     type = ThermalConductivitySheathAux
     variable = k_sheath
@@ -184,30 +165,19 @@
 
 ##Solve for the Variables
 [Kernels]
-  [./HC] ##solves for the thermal conductivity - couples to Heat_dt, HeatSource and Densification_Fraction
+  [./HC] ##solves for the thermal conductivity - couples to Heat_dt and HeatSource
     type = HeatConduction
     variable = temp
   [../]
-  [./Heat_dt] ##solves for the time rate of change of the thermal conductivity - couples to HC, HeatSource and Densification_Fraction
+  [./Heat_dt] ##solves for the time rate of change of the thermal conductivity - couples to HC and HeatSource
     type = HeatConductionTimeDerivative
     variable = temp
   [../]
-  [./HeatSource] ##solves for the temperature of the pellet given the heat produced from nuclear fission (uses the FissionHeatMaterial) - couples to HC, Heat_dt and Densification_Fraction
+  [./HeatSource] ##solves for the temperature of the pellet given the heat produced from nuclear fission (uses the FissionHeatMaterial) - couples to HC and Heat_dt
     type = FissionHeatKernel
     variable = temp
     block = pellet
   [../]
-  [./Densification_Fraction_RHS] ##solves for F_porosity - couples to Denisification_Fraction_LHS
-    type = DensificationFractionKernel
-    variable = densification_fraction ##this is a decimal value
-    temp = temp
-    burnup_dt = burnup_dt
-    model_densification_fraction = true
-  [../]
-  [./Densification_Fraction_LHS] ##solves for F_porosity - couples to Denisification_Fraction_RHS
-    type = TimeDerivative
-    variable = densification_fraction ##this is a decimal value
-  [../]
 [] ##Kernels
 
 ##Allows for solid mechanics to be used
@@ -285,14 +255,17 @@
 [] ##ThermalContact
 
 [Materials]
+  [./Densification] ##Integrates the densification fraction at each quadrature point, read by HCM_Pellet and vstrain_aux
+    type = DensificationMaterial
+    block = pellet
+    temp = temp
+    burnup_dt = burnup_dt
+  [../]
   [./HCM_Pellet] ##Determines the thermal properties of the pellet - thermal conductivity, specific heat, porosity. If these models are set to false, then default values of 1 are given
     type = PelletThermalMaterial
     temp = temp
     burnup = burnup
     burnup_dt = burnup_dt
-    densification_fraction = densification_fraction
-    k_pellets = k_pellets
-    k_pellets_dT = k_pellets_dT
     block = pellet
     initial_porosity = 0.0286
     model_thermal_conductivity = true
@@ -364,13 +337,10 @@
   [../]
   [./FissionHeat] ##Determines the amount of heat produced by nuclear fission
     type = FissionHeatMaterial
-    burnup_avg = avg_burnup
+    power_object = fission_power ##linear power, flux parameters and profile normalisation once per step
     block = pellet
-    linear_power = linear_power_function_time
     initial_fuel_density = 1.065e4
     initial_qfission = 0
-    enrichment = 1
-    pellet_radius = 6.118e-3
     ratio = 0.925
 		initial_fuel_area = 1.1767e-4 ##in m^2, for a full rod
     is_3D = true
@@ -379,6 +349,39 @@
   [../]
 [] ##Materials
 
+##Computes the local burnup, its rate and the pellet average burnup in one pass, then the uniform fission heat quantities
+[UserObjects]
+  [./burnup_uo]
+    type = BurnupUserObject
+    burnup = burnup
+    block = pellet
+    execute_on = timestep_begin
+  [../]
+  [./fission_power] ##The parts of the fission heat that are the same over the whole pellet, read by FissionHeat
+    type = LinearPowerUserObject
+    linear_power = linear_power_function_time
+    burnup_object = burnup_uo
+    initial_fuel_density = 1.065e4
+    enrichment = 1 ##also used by FissionHeat
+    pellet_radius = 6.118e-3
+    execute_on = timestep_begin
+  [../]
+[] ##UserObjects
+
+##Pellet results, also collected by CANDU_sweep.i
+[Postprocessors]
+  [./max_fuel_temp]
+    type = ElementExtremeValue
+    variable = temp
+    block = pellet
+  [../]
+  [./average_burnup]
+    type = ElementAverageValue
+    variable = avg_burnup
+    block = pellet
+  [../]
+[] ##Postprocessors
+
 
 [Executioner]
   type = Transient
@@ -410,14 +413,17 @@
   end_time = 2.5056e7 #290 days in the reactor
   num_steps = 5000
 
-  [./TimeStepper]
-    type = IterationAdaptiveDT
+  [./TimeStepper] ##grows the step at steady power, limited by the burnup and fuel temperature change per step and short at the power ramp
+    type = IrradiationDT
     dt = .25
     cutback_factor = 0.5
     growth_factor = 2
-    optimal_iterations = 10
-    iteration_window = 2 #0.2*optimal_iterations
-    linear_iteration_ratio = 100
+    burnup = average_burnup
+    max_burnup_increment = 10 #[MWh/kgU]
+    temperature = max_fuel_temp
+    max_temperature_change = 50 #[K]
+    linear_power = linear_power_function_time
+    max_power_change = 0.05
   [../]
 [] ##Executioner
 
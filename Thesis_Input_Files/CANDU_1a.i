@@ -64,11 +64,6 @@
     family = MONOMIAL
     block = pellet
   [../]
-  [./k_pellets_dT]
-    order = FIRST
-    family = MONOMIAL
-    block = pellet
-  [../]
   [./k_sheath]
     order = FIRST
     family = MONOMIAL
@@ -98,40 +93,34 @@
   [../]
   [./disp_z] ##z-displacement variable
   [../]
-  [./densification_fraction] ##densification fraction variable - a percentage less than 60%
-    initial_condition = 0
-    block = pellet
-  [../]
 [] ##Variables
 
 ##Solve for the AuxVariables - these do not solve ODE/PDE
 [AuxKernels]
-  [./avg_burnup_aux] ##solves for avg_burnup auxvariable
-    type = AverageBurnupAux
+  [./avg_burnup_aux] ##copies the pellet average burnup from burnup_uo
+    type = BurnupFieldAux
     variable = avg_burnup
-    initial_density = 1.065e4
+    burnup_object = burnup_uo
+    quantity = average_burnup
     execute_on = timestep_begin
-    model_wrt_time = true
-    linear_power_time = linear_power_function_time
-    model_wrt_burnup = false
-    linear_power_burnup = linear_power_function_burnup
   [../]
-  [./burnup_aux] ##solves for burnup auxvariable
-    type = BurnupAux
+  [./burnup_aux] ##copies the local burnup from burnup_uo
+    type = BurnupFieldAux
     variable = burnup
+    burnup_object = burnup_uo
+    quantity = burnup
     execute_on = timestep_begin
-    model_burnup = false
   [../]
-  [./burnup_dt_aux] ##solves for burnup auxvariable
-    type = Burnup_dtAux
+  [./burnup_dt_aux] ##copies the local burnup rate from burnup_uo
+    type = BurnupFieldAux
     variable = burnup_dt
+    burnup_object = burnup_uo
+    quantity = burnup_dt
     execute_on = timestep_begin
-    model_burnup_dt = false
   [../]
   [./vstrain_aux] ##solves for burnup auxvariable
     type = VStrainAux
     variable = vstrain
-    densification_fraction = densification_fraction
     execute_on = timestep_begin
     initial_porosity = 0.0286
     model_vstrain = false
@@ -144,14 +133,6 @@
     execute_on = timestep_begin
     model_k = false
   [../]
-  [./k_pellets_dT_aux] ##solves for burnup auxvariable
-    type = ThermalConductivity_dTPelletsAux
-    variable = k_pellets_dT
-    temp = temp
-    burnup = burnup
-    execute_on = timestep_begin
-    model_k_dT = false
-  [../]
   [./k_sheath_aux] ##solves for burnup auxvariable
     type = ThermalConductivitySheathAux
     variable = k_sheath
@@ -184,30 +165,19 @@
 
 ##Solve for the Variables
 [Kernels]
-  [./HC] ##solves for the thermal conductivity - couples to Heat_dt, HeatSource and Densification_Fraction
+  [./HC] ##solves for the thermal conductivity - couples to Heat_dt and HeatSource
     type = HeatConduction
     variable = temp
   [../]
-  [./Heat_dt] ##solves for the time rate of change of the thermal conductivity - couples to HC, HeatSource and Densification_Fraction
+  [./Heat_dt] ##solves for the time rate of change of the thermal conductivity - couples to HC and HeatSource
     type = HeatConductionTimeDerivative
     variable = temp
   [../]
-#  [./HeatSource] ##solves for the temperature of the pellet given the heat produced from nuclear fission (uses the FissionHeatMaterial) - couples to HC, Heat_dt and Densification_Fraction
+#  [./HeatSource] ##solves for the temperature of the pellet given the heat produced from nuclear fission (uses the FissionHeatMaterial) - couples to HC and Heat_dt
 #    type = FissionHeatKernel
 #    variable = temp
 #    block = pellet
 #  [../]
-  [./Densification_Fraction_RHS] ##solves for F_porosity - couples to Denisification_Fraction_LHS
-    type = DensificationFractionKernel
-    variable = densification_fraction ##this is a decimal value
-    temp = temp
-    burnup_dt = burnup_dt
-    model_densification_fraction = true
-  [../]
-  [./Densification_Fraction_LHS] ##solves for F_porosity - couples to Denisification_Fraction_RHS
-    type = TimeDerivative
-    variable = densification_fraction ##this is a decimal value
-  [../]
 [] ##Kernels
 
 ##Allows for solid mechanics to be used
@@ -291,14 +261,17 @@
 #[] ##ThermalContact
 
 [Materials]
+  [./Densification] ##Integrates the densification fraction at each quadrature point, read by HCM_Pellet and vstrain_aux
+    type = DensificationMaterial
+    block = pellet
+    temp = temp
+    burnup_dt = burnup_dt
+  [../]
   [./HCM_Pellet] ##Determines the thermal properties of the pellet - thermal conductivity, specific heat, porosity. If these models are set to false, then default values of 1 are given
     type = PelletThermalMaterial
     temp = temp
     burnup = burnup
     burnup_dt = burnup_dt
-    densification_fraction = densification_fraction
-    k_pellets = k_pellets
-    k_pellets_dT = k_pellets_dT
     block = pellet
     initial_porosity = 0.0286
     model_thermal_conductivity = false
@@ -370,7 +343,7 @@
   [../]
   [./FissionHeat] ##Determines the amount of heat produced by nuclear fission
     type = FissionHeatMaterial
-    burnup_avg = avg_burnup
+    burnup_object = burnup_uo
     block = pellet
     linear_power = linear_power_function_time
     initial_fuel_density = 1.065e4
@@ -385,6 +358,16 @@
   [../]
 [] ##Materials
 
+##Computes the local burnup, its rate and the pellet average burnup in one pass
+[UserObjects]
+  [./burnup_uo]
+    type = BurnupUserObject
+    burnup = burnup
+    block = pellet
+    execute_on = timestep_begin
+  [../]
+[] ##UserObjects
+
 
 
 [Executioner]
@@ -0,0 +1,459 @@
+########################################################
+##Base irradiation of the CANDU_branches.i power history branches: CANDU_1.i run for the first
+##100 days, saving its state (Outputs/branch) and the branch point (BranchPoint) at 100 days
+##The branches run this deck with BranchPoint/mode = branch and restart from the saved state, so
+##apart from the power history it has to stay the same as the base run
+########################################################
+
+[GlobalParams]
+  family = LAGRANGE
+  order = SECOND
+[]
+
+[Problem]
+	coord_type = XYZ
+[]
+
+##Trelis geometry
+[Mesh]
+  file = Thesis_Geometry/CANDU_cross_section.e
+  displacements = 'disp_x disp_y disp_z'
+  patch_size = 1000
+[] ##Mesh
+
+##Functions to be used in the Kernels, AuxKernels and Materials
+[Functions]
+  [./linear_power_function_time] ##scale this for volume and then increase with increasing radius, find a way to make this bundle power the same as a CANDU,
+    type = PiecewiseLinear
+    x = '0 10'
+    y = '0 43000' ##[W/m]
+  [../]
+	[./linear_power_function_burnup]
+		type = PiecewiseLinear
+		x = '0'
+		y = '0'
+	[../]
+  [./pressure_ramp]
+    type = PiecewiseLinear
+    x = '0 1'
+    y = '0 1'
+  [../]
+[] ##Functions
+
+##Variables to be solved for in the AuxKernels
+[AuxVariables]
+  [./avg_burnup] ##solves for the average burnup - only used in FissionHeatMaterial
+    order = FIRST
+    family = MONOMIAL
+    block = pellet
+  [../]
+  [./burnup] ##solves for the local burnup - used everywhere except FissionHeatMaterial
+    order = FIRST
+    family = MONOMIAL
+    block = pellet
+  [../]
+  [./burnup_dt] ##solves for the local burnup_dt
+    order = FIRST
+    family = MONOMIAL
+    block = pellet
+  [../]
+  [./vstrain] ##solves for the volumetric strain
+    order = FIRST
+    family = MONOMIAL
+    block = pellet
+  [../]
+  [./k_pellets]
+    order = FIRST
+    family = MONOMIAL
+    block = pellet
+  [../]
+  [./k_sheath]
+    order = FIRST
+    family = MONOMIAL
+    block = sheath
+  [../]
+  [./k_sheath_dT]
+    order = FIRST
+    family = MONOMIAL
+    block = sheath
+  [../]
+  [./test]
+    order = FIRST
+    family = MONOMIAL
+    block = pellet
+  [../]
+[] ##AuxVariables
+
+##Variables to be solved for in the differential equations (ODE/PDE) in the Kernels
+[Variables]
+  [./temp] ##temperature variable
+    initial_condition = 550
+    block = 'pellet sheath'
+  [../]
+  [./disp_x] ##x-displacement variable
+  [../]
+  [./disp_y] ##y-displacement variable
+  [../]
+  [./disp_z] ##z-displacement variable
+  [../]
+[] ##Variables
+
+##Solve for the AuxVariables - these do not solve ODE/PDE
+[AuxKernels]
+  [./avg_burnup_aux] ##copies the pellet average burnup from burnup_uo
+    type = BurnupFieldAux
+    variable = avg_burnup
+    burnup_object = burnup_uo
+    quantity = average_burnup
+    execute_on = timestep_begin
+  [../]
+  [./burnup_aux] ##copies the local burnup from burnup_uo
+    type = BurnupFieldAux
+    variable = burnup
+    burnup_object = burnup_uo
+    quantity = burnup
+    execute_on = timestep_begin
+  [../]
+  [./burnup_dt_aux] ##copies the local burnup rate from burnup_uo
+    type = BurnupFieldAux
+    variable = burnup_dt
+    burnup_object = burnup_uo
+    quantity = burnup_dt
+    execute_on = timestep_begin
+  [../]
+  [./vstrain_aux] ##solves for burnup auxvariable
+    type = VStrainAux
+    variable = vstrain
+    execute_on = timestep_begin
+    initial_porosity = 0.0286
+    model_vstrain = true
+  [../]
+  [./k_pellets_aux] ##solves for burnup auxvariable
+    type = ThermalConductivityPelletsAux
+    variable = k_pellets
+    temp = temp
+    burnup = burnup
+    execute_on = timestep_begin
+    model_k = true
+  [../]
+  [./k_sheath_aux] ##solves for burnup auxvariable
+    type = ThermalConductivitySheathAux
+    variable = k_sheath
+    temp = temp
+    execute_on = timestep_begin
+    model_k = true
+  [../]
+  [./k_sheath_dT_aux] ##solves for burnup auxvariable
+    type = ThermalConductivity_dTSheathAux
+    variable = k_sheath_dT
+    temp = temp
+    execute_on = timestep_begin
+    model_k_dT = true
+  [../]
+  [./test_aux]
+    type = TestAux
+    variable = test
+    execute_on = timestep_begin
+    model_density = true
+    model_q_fission = false
+    model_q_fission_old = false
+    model_ratio = false
+    model_pellet_radius = false
+    model_porosity = false
+    model_enrichment = false
+    model_SFP = false
+    model_GFP = false
+  [../]
+[] ##AuxKernels
+
+##Solve for the Variables
+[Kernels]
+  [./HC] ##solves for the thermal conductivity - couples to Heat_dt and HeatSource
+    type = HeatConduction
+    variable = temp
+  [../]
+  [./Heat_dt] ##solves for the time rate of change of the thermal conductivity - couples to HC and HeatSource
+    type = HeatConductionTimeDerivative
+    variable = temp
+  [../]
+  [./HeatSource] ##solves for the temperature of the pellet given the heat produced from nuclear fission (uses the FissionHeatMaterial) - couples to HC and Heat_dt
+    type = FissionHeatKernel
+    variable = temp
+    block = pellet
+  [../]
+[] ##Kernels
+
+##Allows for solid mechanics to be used
+[SolidMechanics]
+  [./solid]
+    temp = temp
+    disp_x = disp_x
+    disp_y = disp_y
+    disp_z = disp_z
+  [../]
+[] ##SolidMechanics
+
+[BCs]
+  [./Sheath_out] ##Specifies the coolant temperature and the rate of heat flux out of the bundle
+    type = ConvectiveFluxFunction
+    variable = temp
+    boundary = 'sheath_out'
+    T_infinity = 550
+    coefficient = 5e4
+  [../]
+  [./Y] ##Constrains the midline_x of the pellet and sheath to not move vertically
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'pellet_x sheath_x'
+    value = 0
+  [../]
+  [./X] ##Constrains the midline_y of the pellet and sheath to not move horizontally
+    type = DirichletBC
+    variable = disp_x
+    boundary = 'pellet_y sheath_y'
+    value = 0
+  [../]
+  [./Z] ##Constrains the pellet and sheath to not move vertically
+    type = DirichletBC
+    variable = disp_z
+    boundary = 'pellet_bot sheath_bot' ##allows the pellet to expand in one direction in Z
+    value = 0
+  [../]
+  [./Pressure] ##applies the 10MPa pressure to the sheath
+    [./coolant_pressure]
+      disp_x = disp_x
+      disp_y = disp_y
+      disp_z = disp_z
+      boundary = sheath_out
+      factor = 1e7
+      function = pressure_ramp
+    [../]
+  [../]
+[] ##BCs
+
+##Specifies the properties when the pellet-sheath contact each other - specifies the penalty factor coefficient
+[Contact]
+  [./pellet_to_sheath_contact]
+    slave = pellet_out
+    master = sheath_in
+    formulation = penalty
+    model = frictionless
+    penalty = 1e8
+    disp_x = disp_x
+    disp_y = disp_y
+    disp_z = disp_z
+  [../]
+[] ##Contact
+
+##Allows heat to transfer over the gap between the pellet-sheath
+[ThermalContact]
+  [./pellet_to_sheath]
+    type = GapHeatTransfer
+    variable = temp
+    slave = pellet_out
+    master = sheath_in
+    quadrature = true
+    gap_conductivity= 0.15
+  [../]
+[] ##ThermalContact
+
+[Materials]
+  [./Densification] ##Integrates the densification fraction at each quadrature point, read by HCM_Pellet and vstrain_aux
+    type = DensificationMaterial
+    block = pellet
+    temp = temp
+    burnup_dt = burnup_dt
+  [../]
+  [./HCM_Pellet] ##Determines the thermal properties of the pellet - thermal conductivity, specific heat, porosity. If these models are set to false, then default values of 1 are given
+    type = PelletThermalMaterial
+    temp = temp
+    burnup = burnup
+    burnup_dt = burnup_dt
+    block = pellet
+    initial_porosity = 0.0286
+    model_thermal_conductivity = true
+    model_specific_heat = true
+    model_porosity = true ##this causes no change in density, as it is not yet coupled to density
+    model_alpha = true
+    model_SFP = true
+    model_GFP = true
+    display_values = false
+  [../]
+  [./HCM_Sheath] ##Determines the thermal properties of the sheath - thermal conductivity, specific heat, thermal expansion
+    type = SheathThermalMaterial
+    temp = temp
+    block = sheath
+    k_sheath = k_sheath
+    k_sheath_dT = k_sheath_dT
+    model_thermal_conductivity = true
+    model_specific_heat = true
+  [../]
+  [./Mechanical_Pellets] ##Determines the solid mechanical properties of the pellet - stresses, strains
+    type = StrainMaterial
+    temp = temp
+    burnup = burnup
+    burnup_dt = burnup_dt
+    vstrain = vstrain
+    block = pellet
+    disp_x = disp_x
+    disp_y = disp_y
+    disp_z = disp_z
+    poissons_ratio = 0.3
+    youngs_modulus = 1.8e11
+    model_thermal_expansion = true
+    model_youngs_modulus = true
+    display_values = false
+  [../]
+  [./Mechanical_Sheath] ##Determines the solid mechanical properties of the sheath - stresses, strains
+    type = SheathMechanicalMaterial
+    temp = temp
+    block = sheath
+    disp_x = disp_x
+    disp_y = disp_y
+    disp_z = disp_z
+    poissons_ratio = 0.3
+    youngs_modulus = 1.8e11
+    relative_tolerance = 1e-4
+    absolute_tolerance = 1e-9
+    max_its = 14
+    output_iteration_info = false
+    model_diffusional_creep = false
+    model_thermal_expansion = true
+    model_youngs_modulus = true
+    display_values = false
+  [../]
+  [./Pellet_density ] ##Specifies the density of the pellets
+    type = Density
+    block = pellet
+    disp_x = disp_x
+    disp_y = disp_y
+    disp_z = disp_z
+    density = 1.065e4
+  [../]
+  [./Sheath_density] ##Specifies the density of the sheath
+    type = Density
+    block = sheath
+    disp_x = disp_x
+    disp_y = disp_y
+    disp_z = disp_z
+    density = 6.5e3
+  [../]
+  [./FissionHeat] ##Determines the amount of heat produced by nuclear fission
+    type = FissionHeatMaterial
+    power_object = fission_power ##linear power, flux parameters and profile normalisation once per step
+    block = pellet
+    initial_fuel_density = 1.065e4
+    initial_qfission = 0
+    ratio = 0.925
+		initial_fuel_area = 1.1767e-4 ##in m^2, for a full rod
+    is_3D = true
+    model_Qfission = true
+		model_plate_fuel = false
+  [../]
+[] ##Materials
+
+##Computes the local burnup, its rate and the pellet average burnup in one pass, then the uniform fission heat quantities
+[UserObjects]
+  [./burnup_uo]
+    type = BurnupUserObject
+    burnup = burnup
+    block = pellet
+    execute_on = timestep_begin
+  [../]
+  [./fission_power] ##The parts of the fission heat that are the same over the whole pellet, read by FissionHeat
+    type = LinearPowerUserObject
+    linear_power = linear_power_function_time
+    burnup_object = burnup_uo
+    initial_fuel_density = 1.065e4
+    enrichment = 1 ##also used by FissionHeat
+    pellet_radius = 6.118e-3
+    execute_on = timestep_begin
+  [../]
+[] ##UserObjects
+
+##Pellet results, also collected by CANDU_sweep.i
+[Postprocessors]
+  [./max_fuel_temp]
+    type = ElementExtremeValue
+    variable = temp
+    block = pellet
+  [../]
+  [./average_burnup]
+    type = ElementAverageValue
+    variable = avg_burnup
+    block = pellet
+  [../]
+[] ##Postprocessors
+
+
+[Executioner]
+  type = Transient
+
+  #Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-ksp_gmres_restart -pc_type -pc_hypre_type -pc_hypre_boomeramg_max_iter'
+  petsc_options_value = '201                hypre    boomeramg      8'
+
+  line_search = 'none'
+
+  #petsc options from previous example
+  #	petsc_options_iname = '-pc_type -pc_hypre_type'
+  #  petsc_options_value = 'hypre boomeramg'
+
+  # controls for linear iterations
+  l_max_its = 100
+  l_tol = 1e-3 #3
+
+  # controls for nonlinear iterations
+  nl_max_its = 15
+  nl_abs_tol = 5e-9 #10
+  nl_rel_tol = 1e-5 #5
+
+  #time control
+  start_time = 0.0
+  #  dt = 10.0
+  end_time = 8.64e6 #100 days in the reactor, the branches continue to 290 days
+  num_steps = 5000
+
+  [./TimeStepper] ##grows the step at steady power, limited by the burnup and fuel temperature change per step and short at the power ramp
+    type = IrradiationDT
+    dt = .25
+    cutback_factor = 0.5
+    growth_factor = 2
+    burnup = average_burnup
+    max_burnup_increment = 10 #[MWh/kgU]
+    temperature = max_fuel_temp
+    max_temperature_change = 50 #[K]
+    linear_power = linear_power_function_time
+    max_power_change = 0.05
+  [../]
+[] ##Executioner
+
+
+[Outputs]
+  file_base = Thesis_Paraview/CANDU_base
+  output_initial = true
+  exodus = true
+  print_linear_residuals = true
+  print_perf_log = true
+  [./branch] ##the solution, aux fields and stateful material properties at the branch time
+    type = Checkpoint
+    sync_times = 8.64e6
+    sync_only = true
+  [../]
+[] ##Outputs
+
+
+##Writes the branch point file the branches are checked against (mode = save), or checks them (mode = branch)
+[BranchPoint]
+  file = Thesis_Paraview/CANDU_base.branch
+  mode = save
+  time = 8.64e6
+  checkpoint = Thesis_Paraview/CANDU_base_cp ##the branch Checkpoint's directory, the step it writes at is appended to the file
+[] ##BranchPoint
+
+
+[Debug]
+  show_var_residual_norms = false
+[] ##Debug
@@ -0,0 +1,63 @@
+########################################################
+##Power history branches of CANDU_1.i from a shared base irradiation of 100 days (CANDU_base.i)
+##
+##1. Run the base case once, it saves its state at 100 days and records the checkpoint in the branch point file:
+##     ./caribou-opt -i Thesis_Input_Files/CANDU_base.i
+##2. Run the branches, each restarts from that checkpoint instead of repeating the base irradiation:
+##     mpiexec -n 4 ./caribou-opt -i Thesis_Input_Files/CANDU_branches.i
+##Every branch is checked against the branch point, and has to run on as many processors as the base case
+########################################################
+
+##The master only keeps time, the branches solve the fuel
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[] ##Mesh
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Variables]
+  [./dummy]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[] ##Variables
+
+[MultiApps]
+  [./branches]
+    type = ParameterSweepMultiApp
+    app_type = CaribouApp
+    execute_on = timestep
+    input_files = Thesis_Input_Files/CANDU_base.i
+    parameter_file = Thesis_Input_Files/CANDU_branches.txt
+    sub_cycling = true
+  [../]
+[] ##MultiApps
+
+[UserObjects]
+  [./results]
+    type = SweepResults
+    multi_app = branches
+    postprocessors = 'max_fuel_temp average_burnup'
+    file = Thesis_Paraview/CANDU_branches.csv
+  [../]
+[] ##UserObjects
+
+[Executioner]
+  type = Transient
+
+  #time control, the branches start where the base case was saved
+  start_time = 8.64e6
+  end_time = 2.5056e7 #290 days in the reactor
+  dt = 8.64e4
+[] ##Executioner
+
+[Outputs]
+  file_base = Thesis_Paraview/CANDU_branches_out
+  exodus = false
+  print_perf_log = true
+[] ##Outputs
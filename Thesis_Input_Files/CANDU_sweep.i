@@ -0,0 +1,59 @@
+########################################################
+##Parameter sweep over CANDU_1.i, every row of CANDU_sweep.txt runs as a sub-app of this job
+##Run from the repository root, e.g. mpiexec -n 8 ./caribou-opt -i Thesis_Input_Files/CANDU_sweep.i
+########################################################
+
+##The master only keeps time, the variants solve the fuel
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[] ##Mesh
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Variables]
+  [./dummy]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[] ##Variables
+
+[MultiApps]
+  [./variants]
+    type = ParameterSweepMultiApp
+    app_type = CaribouApp
+    execute_on = timestep
+    input_files = Thesis_Input_Files/CANDU_1.i
+    parameter_file = Thesis_Input_Files/CANDU_sweep.txt
+    sub_cycling = true ##each variant takes its own time steps between the master's
+  [../]
+[] ##MultiApps
+
+##Collects the results of every variant into one file
+[UserObjects]
+  [./results]
+    type = SweepResults
+    multi_app = variants
+    postprocessors = 'max_fuel_temp average_burnup'
+    file = Thesis_Paraview/CANDU_sweep.csv
+  [../]
+[] ##UserObjects
+
+[Executioner]
+  type = Transient
+
+  #time control, results are collected once a day
+  start_time = 0.0
+  end_time = 2.5056e7 #290 days in the reactor
+  dt = 8.64e4
+[] ##Executioner
+
+[Outputs]
+  file_base = Thesis_Paraview/CANDU_sweep_out
+  exodus = false
+  print_perf_log = true
+[] ##Outputs
@@ -0,0 +1,60 @@
+#ifndef BRANCHPOINTACTION_H
+#define BRANCHPOINTACTION_H
+
+#include "Action.h"
+
+#include <string>
+#include <vector>
+
+//Forward Declarations
+class BranchPointAction;
+class Material;
+
+template<>
+InputParameters validParams<BranchPointAction>();
+
+/**
+ * Saves and checks the branch point of a family of runs that share a base irradiation.
+ *
+ * The base run saves its state with a Checkpoint output at the branch time (sync_times and
+ * sync_only), which holds the solution, the aux fields and every stateful material property, and
+ * this action (mode = save) writes the branch point file: the branch time and the layout of the
+ * problem, i.e. the mesh size, the number of processors, the variables of each system, and the
+ * materials of each block and boundary in the order they were added, each with its properties
+ * listed by name. It also adds a BranchPointRecorder, which appends the checkpoint written at the
+ * branch time once the run gets there.
+ *
+ * Each branch run restarts from that checkpoint with its own power history. With mode = branch
+ * this action compares the branch's layout and start time with the branch point file and sets the
+ * restart file to the recorded checkpoint, replacing any Problem/restart_file_base, before anything
+ * is restored. The stateful properties are read back by position, so a different material setup
+ * would otherwise load silently into the wrong properties.
+ * The order in which a material declares its properties is not compared; it is the same as long as
+ * the branch builds the same materials, which is what the comparison checks.
+ */
+class BranchPointAction : public Action
+{
+public:
+  BranchPointAction(const std::string & name, InputParameters params);
+
+  virtual void act();
+
+protected:
+  /// One line per mesh, system and material of each block and boundary, describing what the checkpoint holds
+  std::vector<std::string> layout() const;
+
+  /// Adds one line per material, with where it lives (e.g. "block 1") and its properties
+  void addMaterials(const std::string & where, const std::vector<Material *> & materials, std::vector<std::string> & lines) const;
+
+  void writeBranchPoint(const std::vector<std::string> & layout) const;
+
+  /// Compares the layout and start time with the branch point, returns the checkpoint to restart from
+  std::string checkBranchPoint(const std::vector<std::string> & layout) const;
+
+  /// Start time of the Executioner
+  Real startTime() const;
+
+  const std::string & _file_name;
+};
+
+#endif //BRANCHPOINTACTION_H
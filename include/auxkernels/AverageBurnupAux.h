@@ -7,6 +7,8 @@
 
 //Forward Declaration
 class AverageBurnupAux;
+class HotPathCounters;
+class LinearPowerUserObject;
 
 template<>
 InputParameters validParams<AuxKernel>();
@@ -19,9 +21,16 @@ public:
 
 protected:
   virtual Real computeValue();
+  virtual void compute();
+
+	//times compute() in HotPathCounters
+	HotPathCounters & _hot_path_counters;
+	const unsigned int _hot_path_timer;
 
 	Function * const _linear_power_time;
 	Function * const _linear_power_burnup;
+	//the linear power and uranium mass per length evaluated once per step, instead of the functions
+	const LinearPowerUserObject * const _power_object;
 
 	const bool _model_wrt_time;
 	const bool _model_wrt_burnup;
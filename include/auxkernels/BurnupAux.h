@@ -7,6 +7,7 @@
 
 //Forward Declarations
 class BurnupAux;
+class HotPathCounters;
 
 template<>
 InputParameters validParams<AuxKernel>();
@@ -19,6 +20,11 @@ public:
 
 protected:
   virtual Real computeValue();
+  virtual void compute();
+
+	//times compute() in HotPathCounters
+	HotPathCounters & _hot_path_counters;
+	const unsigned int _hot_path_timer;
 
 	const bool _model_burnup;
 private:
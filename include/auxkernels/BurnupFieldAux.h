@@ -0,0 +1,39 @@
+#ifndef BURNUPFIELDAUX_H
+#define BURNUPFIELDAUX_H
+
+#include "AuxKernel.h"
+
+//Forward Declaration
+class BurnupFieldAux;
+class HotPathCounters;
+class BurnupUserObject;
+
+template<>
+InputParameters validParams<BurnupFieldAux>();
+
+class BurnupFieldAux : public AuxKernel
+{
+public:
+
+  BurnupFieldAux(const std::string & name, InputParameters parameters);
+
+protected:
+  virtual Real computeValue();
+  virtual void compute();
+
+	//times compute() in HotPathCounters
+	HotPathCounters & _hot_path_counters;
+	const unsigned int _hot_path_timer;
+
+	const BurnupUserObject & _burnup_object;
+
+	enum Quantity
+	{
+		BURNUP,
+		BURNUP_DT,
+		AVERAGE_BURNUP
+	};
+	const Quantity _quantity;
+ };
+
+#endif //BURNUPFIELDAUX_H
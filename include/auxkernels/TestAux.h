@@ -5,6 +5,7 @@
 
 //Forward Declarations
 class TestAux;
+class HotPathCounters;
 
 template<>
 InputParameters validParams<AuxKernel>();
@@ -17,6 +18,11 @@ public:
 
 protected:
   virtual Real computeValue();
+  virtual void compute();
+
+	//times compute() in HotPathCounters
+	HotPathCounters & _hot_path_counters;
+	const unsigned int _hot_path_timer;
 	const	bool _model_density;
 	const bool _model_q_fission;
 	const bool _model_q_fission_old;
@@ -6,6 +6,7 @@
 
 //Forward Declarations
 class ThermalConductivityPelletsAux;
+class HotPathCounters;
 
 template<>
 InputParameters validParams<AuxKernel>();
@@ -18,11 +19,11 @@ public:
 
 protected:
   virtual Real computeValue();
-  virtual void computeChassieUnirradThCond(const Real temp, Real & cond0);
-	virtual void computeDissFissionProdThCond(const Real temp, const Real burnup, Real & kappa1d);
-	virtual void computePrecFissionProdThCond(const Real temp, const Real burnup, Real & kappa1p);
-	virtual void computePoresThCond(const Real temp, const Real porosity, Real & kappa2p);
-	virtual void computeRadDamageThCond(const Real temp, Real & kappa4r);
+  virtual void compute();
+
+	//times compute() in HotPathCounters
+	HotPathCounters & _hot_path_counters;
+	const unsigned int _hot_path_timer;
 
 	const bool _model_k;
 	const VariableValue & _temp;
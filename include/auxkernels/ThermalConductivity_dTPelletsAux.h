@@ -6,6 +6,7 @@
 
 //Forward Declarations
 class ThermalConductivity_dTPelletsAux;
+class HotPathCounters;
 
 template<>
 InputParameters validParams<AuxKernel>();
@@ -17,11 +18,11 @@ public:
   ThermalConductivity_dTPelletsAux(const std::string & name, InputParameters parameters);
 protected:
   virtual Real computeValue();
-  virtual void computeChassieUnirradThCond(const Real temp, Real & cond0, Real & cond0_dT);
-	virtual void computeDissFissionProdThCond(const Real temp, const Real burnup, Real & kappa1d, Real & kappa1d_dT);
-	virtual void computePrecFissionProdThCond(const Real temp, const Real burnup, Real & kappa1p, Real & kappa1p_dT);
-	virtual void computePoresThCond(const Real temp, const Real porosity, Real & kappa2p, Real & kappa2p_dT);
-	virtual void computeRadDamageThCond(const Real temp, Real & kappa4r, Real & kappa4r_dT);
+  virtual void compute();
+
+	//times compute() in HotPathCounters
+	HotPathCounters & _hot_path_counters;
+	const unsigned int _hot_path_timer;
 
 	const bool _model_k_dT;
 	const VariableValue & _temp;
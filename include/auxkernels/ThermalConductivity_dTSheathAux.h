@@ -6,6 +6,7 @@
 
 //Forward Declarations
 class ThermalConductivity_dTSheathAux;
+class HotPathCounters;
 
 template<>
 InputParameters validParams<AuxKernel>();
@@ -18,6 +19,11 @@ public:
 
 protected:
   virtual Real computeValue();
+  virtual void compute();
+
+	//times compute() in HotPathCounters
+	HotPathCounters & _hot_path_counters;
+	const unsigned int _hot_path_timer;
 
 	const bool _model_k_dT;
 	const VariableValue & _temp;
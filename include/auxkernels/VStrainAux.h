@@ -5,6 +5,7 @@
 
 //Forward Declaration
 class VStrainAux;
+class HotPathCounters;
 
 template<>
 InputParameters validParams<AuxKernel>();
@@ -17,12 +18,21 @@ public:
 
 protected:
   virtual Real computeValue();
+  virtual void compute();
 
+	//times compute() in HotPathCounters
+	HotPathCounters & _hot_path_counters;
+	const unsigned int _hot_path_timer;
+
+	/// Is the densification fraction a variable rather than DensificationMaterial's property?
+	const bool _coupled_densification;
 	const VariableValue  & _densificationF;
 
 	const Real _initial_porosity;
 	bool _model_vstrain;
 private:
+	/// densification_fraction from DensificationMaterial, NULL when coupled
+	const MaterialProperty<Real> * const _densification_property;
 	const MaterialProperty<Real> & _SFP;
 	const MaterialProperty<Real> & _GFP;
  };
@@ -7,6 +7,7 @@
 
 //Forward Declerations
 class DensificationFractionKernel;
+class HotPathCounters;
 
 template<>
 InputParameters validParams<DensificationFractionKernel>();
@@ -20,10 +21,28 @@ public:
 
 protected:
   virtual Real computeQpResidual();
+  virtual Real computeQpJacobian();
+  virtual void computeResidual();
+  virtual void computeJacobian();
+  virtual void computeOffDiagJacobian(unsigned int jvar);
+
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar);
+
+	//time the residual and Jacobian assembly in HotPathCounters
+	HotPathCounters & _hot_path_counters;
+	const unsigned int _residual_timer;
+	const unsigned int _jacobian_timer;
+
+	Real computeRateArgument();
 
 	const bool _model_densification_fraction;
  
   const VariableValue  & _temp;
 	const VariableValue  & _burnup_dt;
+	const unsigned int _temp_var;
+	const unsigned int _burnup_dt_var;
+
+	static const Real _cd; // [kg/MWH]
+	static const Real _bd; // [K^-3]
 };
 #endif //DENSIFICATIONFRACTIONKERNEL_H
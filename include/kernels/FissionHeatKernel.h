@@ -7,6 +7,7 @@
 
 //Forward Declarations
 class FissionHeatKernel;
+class HotPathCounters;
 
 template<>
 InputParameters validParams<FissionHeatKernel>();
@@ -19,9 +20,28 @@ public:
 
 protected:
   virtual Real computeQpResidual();
-	
+  virtual Real computeQpJacobian();
+  virtual void computeResidual();
+  virtual void computeJacobian();
+  virtual void computeOffDiagJacobian(unsigned int jvar);
+
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar);
+
+	//time the residual and Jacobian assembly in HotPathCounters
+	HotPathCounters & _hot_path_counters;
+	const unsigned int _residual_timer;
+	const unsigned int _jacobian_timer;
+
+	Real dLogDetF(const unsigned int c);
+
 private:
 	const MaterialProperty<Real> & _q_fission;
+
+	/// Displacements used by the Density material
+	bool _disp_coupled[3];
+	unsigned int _disp_var[3];
+	const VariableGradient * _grad_disp[3];
+	const VariableValue * _disp_r;
  };
 
 #endif //FISSIONHEATKERNEL_H
@@ -0,0 +1,48 @@
+#ifndef DENSIFICATIONMATERIAL_H
+#define DENSIFICATIONMATERIAL_H
+
+#include "Material.h"
+
+//Forward Declarations
+class DensificationMaterial;
+class HotPathCounters;
+
+template<>
+InputParameters validParams<DensificationMaterial>();
+
+/**
+ * Densification fraction of the pellets, the fraction of the initial porosity removed (eq. 5.55 of
+ * Prudil). The equation is an ODE in time at each point, driven by the local temperature and burnup
+ * rate with no spatial coupling, so it is integrated here at every quadrature point (a backward
+ * Euler step from the value of the last time step) instead of being solved for as a variable with
+ * DensificationFractionKernel. Declares the stateful densification_fraction, read by
+ * PelletThermalMaterial and VStrainAux when they are not given a variable, and densification_fraction_dT,
+ * its derivative with respect to the temperature for their Jacobians.
+ */
+class DensificationMaterial : public Material
+{
+public:
+  DensificationMaterial(const std::string & name, InputParameters parameters);
+
+  virtual void initStatefulProperties(unsigned n_points);
+
+protected:
+  virtual void computeProperties();
+
+	//times computeProperties() in HotPathCounters
+	HotPathCounters & _hot_path_counters;
+	const unsigned int _hot_path_timer;
+
+	const bool _model_densification_fraction;
+	const Real _initial_fraction;
+
+  const VariableValue & _temp;
+	const VariableValue & _burnup_dt;
+
+private:
+	MaterialProperty<Real> & _fraction;
+	MaterialProperty<Real> & _fraction_old;
+	MaterialProperty<Real> & _fraction_dT;
+};
+
+#endif //DENSIFICATIONMATERIAL_H
@@ -4,11 +4,15 @@
 #include "Material.h"
 #include <math.h>
 #include "Function.h"
+#include "FluxParameterTable.h"
 
 //using namespace std;
 
 //Forward declaration
 class FissionHeatMaterial;
+class HotPathCounters;
+class BurnupUserObject;
+class LinearPowerUserObject;
 
 template <>
 InputParameters validParams<FissionHeatMaterial>();
@@ -20,17 +24,26 @@ public:
 	FissionHeatMaterial(const std::string & name, InputParameters parameters);
 
 protected:
-	double interp2(const double _cons_array[][10]);
-	virtual Real bessel0(double x);
-	virtual Real bessel1(double x);
-	Real Q_fission();
-  virtual void computeQpProperties();
+	Real radialCoordinate();
+	Real linearPower();
+	virtual void computeProperties();
 	virtual void initQpStatefulProperties();
+
+	//time computeProperties() and count the flux parameter lookups in HotPathCounters
+	HotPathCounters & _hot_path_counters;
+	const unsigned int _hot_path_timer;
+	const unsigned int _lookup_counter;
 	
 	Function * const _linear_power;
+	//the linear power and, when it has them, the flux parameters evaluated once per step
+	const LinearPowerUserObject * const _power_object;
+	//the power_object evaluates the flux parameters, and gives the enrichment and pellet radius
+	const bool _uniform_flux;
 
 	const bool _model_Qfission;
 
+	//the average burnup comes either from a coupled variable or straight from a BurnupUserObject
+	const BurnupUserObject * const _burnup_object;
   const VariableValue & _burnup_avg;
 	const Real _enrichment_property;
 	const Real _pellet_radius_property;
@@ -42,6 +55,16 @@ protected:
 
 	const bool _is_3D;
 	const bool _model_plate_fuel;
+
+	//beta, kappa and lambda as functions of burnup, for this run's enrichment and pellet radius
+	FluxParameterTable _flux_table;
+
+	//per-element scratch for the batched radial profile
+	std::vector<Real> _r;
+	std::vector<Real> _kappa;
+	std::vector<Real> _beta;
+	std::vector<Real> _lambda;
+	std::vector<Real> _profile;
 private:
 	const MaterialProperty<Real> & _density;
 	MaterialProperty<Real> & _q_fission;
@@ -2,6 +2,12 @@
 #define GAPHEATCONDUCTANCEMATERIAL_H
 
 #include "Material.h"
+#include "DiagnosticsChannel.h"
+
+#include <map>
+
+class PenetrationInfo;
+class HotPathCounters;
 
 /**
  * Generic gap heat transfer model, with h_gap =  h_conduction + h_contact + h_radiation
@@ -21,6 +27,7 @@ public:
 
 protected:
 
+  virtual void computeProperties();
   virtual void computeQpProperties();
 
   /**
@@ -28,15 +35,30 @@ protected:
    */
   virtual void computeQpConductance();
 
-  virtual Real h_gas_conduction();
-  virtual Real h_solid_conduction();
-  virtual Real h_radiation();
-  virtual Real dh_conduction();
-  virtual Real dh_radiation();
   virtual Real gapK();
 
   virtual void computeGapValues();
 
+  /// Slave side data of one contact quadrature node, refreshed whenever its penetration info changes
+  struct GapQuadratureCache
+  {
+    GapQuadratureCache() : qnode_id(0), info(NULL), side(NULL) {}
+
+    unsigned int qnode_id;
+    const PenetrationInfo * info;
+    const Elem * side;
+    Point closest_point;
+    std::vector<unsigned int> dof_indices;
+    std::vector<Real> phi;
+  };
+
+  GapQuadratureCache & quadratureCache();
+
+  /// Times computeProperties() and counts the slave side refreshes of the quadrature caches in HotPathCounters
+  HotPathCounters & _hot_path_counters;
+  const unsigned int _hot_path_timer;
+  const unsigned int _refresh_counter;
+
   const std::string _appended_property_name;
 
   const VariableValue & _temp;
@@ -45,6 +67,8 @@ protected:
 
   bool _quadrature;
 
+  /// Values of the current quadrature point, set by computeGapValues(). MOOSE builds one copy of the
+  /// material per thread, so this scratch (like the quadrature caches below) is never shared.
   Real _gap_temp;
   Real _gap_distance;
   Real _radius;
@@ -77,7 +101,15 @@ protected:
   DofMap * _dof_map;
   const bool _warnings;
   const bool _display_values;
-  const Real _stefanboltzmann;
+  DiagnosticsChannel _diagnostics;
+
+  /// Stefan-Boltzmann constant over the emissivity term of eq. 5.18
+  const Real _radiation_factor;
+
+  /// Quadrature mode caches, per element side
+  std::map<std::pair<unsigned int, unsigned int>, std::vector<GapQuadratureCache> > _gap_cache;
+  std::vector<GapQuadratureCache> * _side_cache;
+  unsigned int _cache_n_dofs;
 };
 
 template<>
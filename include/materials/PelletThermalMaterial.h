@@ -2,9 +2,12 @@
 #define	PELLETTHERMALMATERIAL_H
 
 #include "Material.h"
+#include "CorrelationTable.h"
+#include "DiagnosticsChannel.h"
 
 //Forward Declerations
 class PelletThermalMaterial;
+class HotPathCounters;
 
 template<>
 InputParameters validParams<PelletThermalMaterial>();
@@ -28,6 +31,11 @@ protected:
 	Real computeTheoDensity(const Real alpha, const Real temp);
   Real computeSFPFactor(const Real burnup);
 
+	//time computeProperties() and count the correlation table lookups in HotPathCounters
+	HotPathCounters & _hot_path_counters;
+	const unsigned int _hot_path_timer;
+	const unsigned int _lookup_counter;
+
 	const bool _model_thermal_conductivity;
 	const bool _model_specific_heat;
 	const bool _model_porosity;
@@ -35,17 +43,32 @@ protected:
 	const bool _model_SFP;
 	const bool _model_GFP;
 	const bool _display_values;
+	DiagnosticsChannel _diagnostics;
 
   const VariableValue  & _temp;
 	const VariableValue  & _burnup;
 	const VariableValue  & _burnup_dt;
+
+	/// Is the densification fraction a variable rather than DensificationMaterial's property?
+	const bool _coupled_densification;
 	const VariableValue  & _densificationF;
+
+	/// Are k and k_dT taken from aux variables rather than computed here?
+	const bool _coupled_k;
   const VariableValue    & _k;
   const VariableValue    & _k_dT;
 
 	const Real _initial_porosity;
 
+	/// Tabulated correlations, see CorrelationTable
+	const bool _use_correlation_tables;
+	CorrelationTable _specific_heat_table;
+	CorrelationTable _alpha_table;
+
 private:
+	/// densification_fraction and its temperature derivative from DensificationMaterial, NULL when coupled
+	const MaterialProperty<Real> * const _densification_property;
+	const MaterialProperty<Real> * const _densification_dT;
 	const MaterialProperty<Real> & _density;
 	const MaterialProperty<Real> & _enrichment;
   MaterialProperty<Real> & _thermal_conductivity;
@@ -2,9 +2,14 @@
 #define SHEATHMECHANICALMATERIAL_H
 
 #include "SolidModel.h"
+#include "CorrelationTable.h"
+#include "SheathCreepModel.h"
+#include "DiagnosticsChannel.h"
+#include "ElasticityTensorCache.h"
 
 // Forward declarations
 class SheathMechanicalMaterial;
+class HotPathCounters;
 
 template<>
 InputParameters validParams<SheathMechanicalMaterial>();
@@ -16,31 +21,52 @@ public:
                  InputParameters parameters );
 
 protected:
+	//time computeProperties() and count the creep iterations and table lookups in HotPathCounters
+	HotPathCounters & _hot_path_counters;
+	const unsigned int _hot_path_timer;
+	const unsigned int _creep_solve_counter;
+	const unsigned int _creep_iteration_counter;
+	const unsigned int _lookup_counter;
+	const unsigned int _elasticity_build_counter;
+
   const VariableValue  & _temp;
 
 	const Real _relative_tolerance;
   const Real _absolute_tolerance;
   const unsigned int _max_its;
+
+	/// Diffusional creep law and its sub-newton solve
+	const SheathCreepModel _creep_model;
   const bool _output_iteration_info;
 
   const bool _model_thermal_expansion;
 	const bool _model_youngs_modulus;
 	const bool _model_diffusional_creep;
 	const bool _display_values;
+	DiagnosticsChannel _diagnostics;
+	DiagnosticsChannel _creep_diagnostics;
+
+	/// Tabulated correlations, see CorrelationTable
+	const bool _use_correlation_tables;
+	CorrelationTable _axial_therm_ex_table;
+	CorrelationTable _radial_therm_ex_table;
+	CorrelationTable _youngs_modulus_table;
+
+	/// Reuses the elasticity tensor while the temperature stays in the same bin
+	ElasticityTensorCache _elasticity_cache;
 
 	MaterialProperty<SymmTensor> & _creep_strain;
   MaterialProperty<SymmTensor> & _creep_strain_old;
   MaterialProperty<Real> & _primary_creep_strain;
   MaterialProperty<Real> & _primary_creep_strain_old;
 	
+	virtual void computeProperties();
 	virtual Real computeAxialThermEx(const Real temp);
 	virtual Real computeRadialThermEx(const Real temp);
 	virtual Real computeYoungsModulus(const Real temp);
   virtual void modifyStrainIncrement();
 	virtual void computeStress();
 	virtual bool updateElasticityTensor(SymmElasticityTensor & tensor );
-	virtual double EDOTGB(double T, double sigma_a);
-	virtual double d_EDOTGB_d_sigma(double T, double sigma_a);
 };
 
 #endif //SHEATHMECHANICALMATERIAL_H
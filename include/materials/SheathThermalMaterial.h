@@ -2,9 +2,11 @@
 #define SHEATHTHERMALMATERIAL_H
 
 #include "Material.h"
+#include "CorrelationTable.h"
 
 //Forward Declarations
 class SheathThermalMaterial;
+class HotPathCounters;
 
 template<>
 InputParameters validParams<SheathThermalMaterial>();
@@ -23,6 +25,11 @@ protected:
   virtual void computeProperties();
 	virtual Real computeSpecificHeat(const Real temp);
 
+	//time computeProperties() and count the correlation table lookups in HotPathCounters
+	HotPathCounters & _hot_path_counters;
+	const unsigned int _hot_path_timer;
+	const unsigned int _lookup_counter;
+
 	const bool _model_thermal_conductivity;
 	const bool _model_specific_heat;
 
@@ -30,6 +37,10 @@ protected:
   const VariableGradient & _grad_temp;
   const VariableValue    & _k;
   const VariableValue    & _k_dT;
+
+	/// Tabulated correlations, see CorrelationTable
+	const bool _use_correlation_tables;
+	CorrelationTable _specific_heat_table;
 private:
 
   MaterialProperty<Real>     & _thermal_conductivity;
@@ -8,9 +8,12 @@
 #include "SymmIsotropicElasticityTensor.h"
 #include "VolumetricModel.h"
 #include "SolidModel.h"
+#include "DiagnosticsChannel.h"
+#include "ElasticityTensorCache.h"
 
 // Forward declarations
 class StrainMaterial;
+class HotPathCounters;
 
 template<>
 InputParameters validParams<StrainMaterial>();
@@ -23,11 +26,21 @@ public:
 	virtual Real computeGFP_dT(const Real density, const Real enrichment, const Real burnup, const Real burnup_dt, const Real temp);
 	virtual void computeStress();
 	virtual bool updateElasticityTensor(SymmElasticityTensor & tensor );
-	virtual Real computeYoungsModulus(const Real temp);
+	virtual Real computeYoungsModulus(const Real density, const Real temp);
+	virtual void computeProperties();
 private:
+	//times computeProperties() in HotPathCounters
+	HotPathCounters & _hot_path_counters;
+	const unsigned int _hot_path_timer;
+	const unsigned int _elasticity_build_counter;
+
+	/// Reuses the elasticity tensor while the temperature and density stay in the same bins
+	ElasticityTensorCache _elasticity_cache;
+
 	const bool _model_thermal_expansion;
 	const bool _model_youngs_modulus;
 	const bool _display_values;
+	DiagnosticsChannel _diagnostics;
 
   const VariableValue  & _temp;
   const VariableValue  & _temp_old;
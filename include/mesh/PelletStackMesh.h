@@ -0,0 +1,134 @@
+#ifndef PELLETSTACKMESH_H
+#define PELLETSTACKMESH_H
+
+#include "MooseMesh.h"
+
+#include <map>
+
+//Forward Declarations
+class PelletStackMesh;
+
+template<>
+InputParameters validParams<PelletStackMesh>();
+
+/**
+ * Builds the mesh of a stack of pellets in a sheath, with an optional endcap, from its dimensions,
+ * so the decks do not need a Trelis/Cubit Exodus file. dim = 2 gives an RZ mesh (r along x, the axis
+ * along y) and dim = 3 a half cylinder (x >= 0, the axis along z) with a butterfly cross-section, a
+ * central block of azimuthal_elems / 4 divisions surrounded by pellet_radial_elems graded rings.
+ *
+ * The pellets are separate pieces stacked from the bottom up (from the endcap when it is at the
+ * bottom), with dishes of dish_depth and dish_radius in both ends. The pellet radial elements shrink
+ * toward the rim by pellet_radial_bias, the size of the rim element over the centre one. The sheath
+ * covers the whole stack and is joined to the endcap, whose face toward the pellets is only the part
+ * inside the sheath.
+ *
+ * Blocks: pellets, sheath, endcap
+ *
+ * Sidesets, named as in the Trelis decks:
+ *   pellets_out, pellets_in (axis in 2D, x = 0 plane in 3D), pellet<i>_bot, pellet<i>_top,
+ *   pellets_bot / pellets_top (the faces between pellets),
+ *   sheath_out, sheath_IN (inner surface, also sheath_in in 2D), sheath_in (x = 0 plane in 3D),
+ *   sheath_bot / sheath_top (when there is no endcap at that end),
+ *   endcap_out, endcap_in, endcap_bot, endcap_top
+ * Nodeset pellet1_point: the centre of the bottom of the first pellet.
+ */
+class PelletStackMesh : public MooseMesh
+{
+public:
+  PelletStackMesh(const std::string & name, InputParameters parameters);
+  PelletStackMesh(const PelletStackMesh & other_mesh);
+  virtual ~PelletStackMesh();
+
+  virtual MooseMesh & clone() const;
+
+  virtual void buildMesh();
+
+protected:
+  /// Surface of the piece a cell facet lies on
+  enum Facet
+  {
+    INTERIOR,
+    AXIS,
+    INNER,
+    OUTER
+  };
+
+  /**
+   * Cells of a cross-section, segments along r in 2D and quads in the x-y plane in 3D, which are
+   * extruded into the elements of a piece
+   */
+  struct CrossSection
+  {
+    std::vector<Point> points;
+    std::vector<std::vector<unsigned int> > cells;
+    std::vector<std::vector<Facet> > facets;
+    /// Whether the cell lies inside the sheath inner radius
+    std::vector<bool> inside;
+    /// Point on the axis, -1 for a ring
+    int centre;
+  };
+
+  /// Sidesets of the surfaces of a piece
+  struct Surfaces
+  {
+    std::vector<std::string> axis;
+    std::vector<std::string> inner;
+    std::vector<std::string> outer;
+    std::vector<std::string> bottom;
+    std::vector<std::string> top;
+    /// Only tag the cells inside the sheath on that end
+    bool bottom_inside;
+    bool top_inside;
+  };
+
+  /// n + 1 radii from r0 to r1, the last element bias times the size of the first
+  static std::vector<Real> graded(const Real r0, const Real r1, const unsigned int n, const Real bias);
+
+  /**
+   * Cross-section through the given radii. A solid one is filled to the axis; in 3D radii[0] is the
+   * half width of its central block and the rings are blended from the block to circles at round.
+   */
+  CrossSection crossSection(const std::vector<Real> & radii, const bool solid, const Real round) const;
+
+  /**
+   * Extrude a cross-section from z0 to z1 in nz layers into elements of block. The bottom nodes are
+   * merged with any of shared at the same place, and the bottom and top nodes are returned.
+   */
+  void extrude(const CrossSection & section, const SubdomainID block, const Real z0, const Real z1, const unsigned int nz, const bool dished,
+               const Surfaces & surfaces, const std::vector<Node *> & shared, std::vector<Node *> & bottom, std::vector<Node *> & top);
+
+  /// Depth of the dish at radius r
+  Real dishDepth(const Real r) const;
+
+  /// Id of a named boundary, added the first time it is asked for
+  BoundaryID boundaryId(const std::string & name);
+
+  const unsigned int _dim;
+
+  const Real _pellet_radius;
+  const Real _pellet_height;
+  const unsigned int _pellet_count;
+  const Real _pellet_gap;
+  const Real _dish_depth;
+  const Real _dish_radius;
+  const Real _sheath_inner_radius;
+  const Real _sheath_outer_radius;
+
+  /// 0 none, 1 bottom, 2 top
+  const unsigned int _endcap;
+  const Real _endcap_thickness;
+  const Real _endcap_gap;
+
+  const unsigned int _pellet_radial_elems;
+  const unsigned int _pellet_axial_elems;
+  const Real _pellet_radial_bias;
+  const unsigned int _sheath_radial_elems;
+  const unsigned int _sheath_axial_elems;
+  const unsigned int _endcap_axial_elems;
+  const unsigned int _azimuthal_elems;
+
+  std::map<std::string, BoundaryID> _boundary_ids;
+};
+
+#endif //PELLETSTACKMESH_H
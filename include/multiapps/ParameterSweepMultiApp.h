@@ -0,0 +1,59 @@
+#ifndef PARAMETERSWEEPMULTIAPP_H
+#define PARAMETERSWEEPMULTIAPP_H
+
+#include "TransientMultiApp.h"
+
+//Forward Declarations
+class ParameterSweepMultiApp;
+
+template<>
+InputParameters validParams<ParameterSweepMultiApp>();
+
+/**
+ * Runs one sub-app per row of a parameter file, all from the same input file, spread over the
+ * processors of a single job like any other MultiApp. The file holds a header naming the input
+ * parameters to vary and one row of values per variant:
+ *
+ *   name      UserObjects/fission_power/enrichment  UserObjects/fission_power/pellet_radius  Functions/linear_power_function_time/y
+ *   CANDU_1   1                                     6.118e-3                                 '0 43000'
+ *   CANDU_1e  0.71                                  6.118e-3                                 '0 43000'
+ *
+ * Values holding spaces (vectors such as a power history) are quoted, # starts a comment and the
+ * name column is optional. The values are passed to each sub-app as command line overrides, so the
+ * variants share the process wide flux parameter tables, while each keeps its own diagnostics
+ * recorder and hot path counters. SweepResults writes a postprocessor table of every variant to a
+ * single file.
+ */
+class ParameterSweepMultiApp : public TransientMultiApp
+{
+public:
+  ParameterSweepMultiApp(const std::string & name, InputParameters parameters);
+
+  /// Name of a variant (its row number if the file has no name column)
+  const std::string & variantName(const unsigned int app) const { return _variant_names[app]; }
+
+  /// Input parameters varied by the sweep
+  const std::vector<std::string> & parameterNames() const { return _parameter_names; }
+
+  /// Values of the varied parameters for a variant
+  const std::vector<std::string> & parameterValues(const unsigned int app) const { return _parameter_values[app]; }
+
+protected:
+  /// One sub-app per variant, all at the origin
+  virtual void fillPositions();
+
+  /// The command line arguments given to the sub-app, followed by the overrides of its variant
+  virtual std::string getCommandLineArgsParamHelper(unsigned int local_app);
+
+  /// Reads the header and rows of the parameter file
+  void readParameterFile(const std::string & file_name);
+
+  /// Splits a line on whitespace, keeping quoted values together
+  static std::vector<std::string> split(const std::string & line);
+
+  std::vector<std::string> _parameter_names;
+  std::vector<std::string> _variant_names;
+  std::vector<std::vector<std::string> > _parameter_values;
+};
+
+#endif //PARAMETERSWEEPMULTIAPP_H
@@ -0,0 +1,83 @@
+#ifndef DUALREAL_H
+#define DUALREAL_H
+
+#include "PhysicsConfig.h"
+
+#include <cmath>
+
+/**
+ * Forward-mode dual number carrying a value and its derivative with respect to one variable.
+ *
+ * Correlations written in terms of DualReal give the property and its derivative from a single
+ * pass, so every exp/pow/sqrt/atan is evaluated once and reused for the derivative.
+ */
+class DualReal
+{
+public:
+  DualReal(const Real value = 0, const Real derivative = 0) : _value(value), _derivative(derivative) {}
+
+  /// The independent variable, with a unit derivative
+  static DualReal variable(const Real value) { return DualReal(value, 1); }
+
+  Real value() const { return _value; }
+  Real derivative() const { return _derivative; }
+
+  DualReal operator-() const { return DualReal(-_value, -_derivative); }
+
+  DualReal & operator+=(const DualReal & b) { _value += b._value; _derivative += b._derivative; return *this; }
+  DualReal & operator-=(const DualReal & b) { _value -= b._value; _derivative -= b._derivative; return *this; }
+  DualReal & operator*=(const DualReal & b) { *this = DualReal(_value * b._value, _derivative * b._value + _value * b._derivative); return *this; }
+  DualReal & operator/=(const DualReal & b)
+  {
+    const Real inv = 1 / b._value;
+    *this = DualReal(_value * inv, (_derivative - _value * inv * b._derivative) * inv);
+    return *this;
+  }
+
+private:
+  Real _value;
+  Real _derivative;
+};
+
+inline DualReal operator+(DualReal a, const DualReal & b) { return a += b; }
+inline DualReal operator-(DualReal a, const DualReal & b) { return a -= b; }
+inline DualReal operator*(DualReal a, const DualReal & b) { return a *= b; }
+inline DualReal operator/(DualReal a, const DualReal & b) { return a /= b; }
+
+inline DualReal operator+(const DualReal & a, const Real b) { return DualReal(a.value() + b, a.derivative()); }
+inline DualReal operator+(const Real a, const DualReal & b) { return DualReal(a + b.value(), b.derivative()); }
+inline DualReal operator-(const DualReal & a, const Real b) { return DualReal(a.value() - b, a.derivative()); }
+inline DualReal operator-(const Real a, const DualReal & b) { return DualReal(a - b.value(), -b.derivative()); }
+inline DualReal operator*(const DualReal & a, const Real b) { return DualReal(a.value() * b, a.derivative() * b); }
+inline DualReal operator*(const Real a, const DualReal & b) { return DualReal(a * b.value(), a * b.derivative()); }
+inline DualReal operator/(const DualReal & a, const Real b) { return DualReal(a.value() / b, a.derivative() / b); }
+inline DualReal operator/(const Real a, const DualReal & b)
+{
+  const Real value = a / b.value();
+  return DualReal(value, -value / b.value() * b.derivative());
+}
+
+inline DualReal exp(const DualReal & a)
+{
+  const Real value = std::exp(a.value());
+  return DualReal(value, value * a.derivative());
+}
+
+inline DualReal sqrt(const DualReal & a)
+{
+  const Real value = std::sqrt(a.value());
+  return DualReal(value, a.derivative() / (2 * value));
+}
+
+inline DualReal atan(const DualReal & a)
+{
+  return DualReal(std::atan(a.value()), a.derivative() / (1 + a.value() * a.value()));
+}
+
+inline DualReal pow(const DualReal & a, const Real b)
+{
+  const Real value = std::pow(a.value(), b);
+  return DualReal(value, b * value / a.value() * a.derivative());
+}
+
+#endif //DUALREAL_H
@@ -0,0 +1,219 @@
+#ifndef FUELCORRELATIONS_H
+#define FUELCORRELATIONS_H
+
+#include "PhysicsConfig.h"
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * Material correlations of the UO2 fuel pellets from Prudil (the conductivity is in PelletConductivity).
+ *
+ * Temperatures are in K, burnup in MWh/kgU, densities in kg/m^3 and enrichment in percent.
+ */
+class FuelCorrelations
+{
+public:
+  /// Density of uranium in UO2 of the given density and enrichment
+  static Real uraniumDensity(const Real density, const Real enrichment);
+
+  /// Specific heat [J/(kg K)], Table 7 of Prudil
+  static Real specificHeat(const Real temp);
+
+  /// Linear thermal expansion coefficient [1/K]
+  static Real thermalExpansion(const Real temp);
+
+  /// Theoretical density at temperature, for the expansion coefficient alpha
+  static Real theoreticalDensity(const Real alpha, const Real temp);
+
+  /// Solid fission product swelling strain, eq. 5.56
+  static Real solidSwelling(const Real burnup);
+
+  /// Gaseous fission product swelling strain accumulated over a time step dt [s], eq. 5.57
+  static Real gaseousSwelling(const Real density, const Real enrichment, const Real burnup, const Real burnup_dt, const Real temp, const Real dt);
+
+  /// Temperature derivative of the gaseous fission product swelling rate
+  static Real gaseousSwelling_dT(const Real density, const Real enrichment, const Real burnup, const Real burnup_dt, const Real temp);
+
+  /// Young's modulus [Pa]
+  static Real youngsModulus(const Real density, const Real temp);
+
+  /// Burnup rate [MWh/(kgU s)] at a volumetric heat generation q_fission [W/m^3], eq. 5.26
+  static Real burnupRate(const Real q_fission, const Real ratio, const Real density_u);
+
+  /// Rate [1/s] of the densification fraction at a burnup rate [MWh/(kgU s)], eq. 5.55 as solved by DensificationFractionKernel
+  static Real densificationRate(const Real fraction, const Real temp, const Real burnup_dt);
+
+  /**
+   * Densification fraction after a backward Euler step of eq. 5.55 over dt [s] from fraction_old,
+   * and its derivative with respect to temperature
+   */
+  static Real densificationStep(const Real fraction_old, const Real temp, const Real burnup_dt, const Real dt, Real & fraction_dT);
+
+  /// Volumetric strain due to densification, eq. 5.50
+  static Real densificationStrain(const Real initial_porosity, const Real fraction);
+
+protected:
+  /// Fission density [fissions/m^3] corresponding to a burnup (or, equally, its rate) at the given uranium density
+  static Real fissionDensity(const Real burnup, const Real density_u);
+};
+
+inline Real
+FuelCorrelations::uraniumDensity(const Real density, const Real enrichment)
+{
+	const Real MU235 = 235.0439; //mass of U-235
+	const Real MU238 = 238.0508; //mass of U-238
+	const Real MUO2 = 270.03; //mass of UO2
+	const Real enrichment_ = enrichment * 1e-2; //converts to a decimal
+
+	//converts from density of uranium oxide to density of uranium
+	return density * (MU235 * enrichment_ + MU238 * (1 - enrichment_)) / MUO2;
+}
+
+inline Real
+FuelCorrelations::specificHeat(const Real temp)
+{
+//many of these values can be found in Table 7 of Prudil
+	const Real R = 1.987; 				//cal/(mol K)
+	const Real theta = 535.285;		// K, 548.68 J/(kg K)
+	const Real Ed = 37694.6;			//cal/mol
+	const Real k1 = 19.145;				//cal/(mol K), 302.27 J/(kg K)
+	const Real k2 = 7.8473e-4;		//cal/(mol K^2), 8.463e-3 J/(kg K^2)
+	const Real k3 = 5.6437e6;			//cal/mol, 8.741e7 J/kg
+
+	const Real temp2 = temp * temp;
+
+	const Real cp = (k1*std::pow(theta,2)*std::exp(theta/temp))/(temp2*std::pow(std::exp(theta/temp)-1,2) + 2*k2*temp + ((k3*Ed)/(R*temp2))*std::exp(-Ed/(R*temp)));
+
+	//Convert to SI units (J/kg)
+	return cp * 15.496;
+}
+
+inline Real
+FuelCorrelations::thermalExpansion(const Real temp)
+{
+	const Real K1 = 1.0e-5;				//K^-1
+	const Real K2 = 3.0e-3;
+	const Real K3 = 4.0e-2;
+	const Real k = 1.3806e-23;		//Boltzmann Constant (J/K)
+	const Real Ed = 6.9e-20;			//J
+
+	const Real temp2 = temp * temp;
+	return (K1 + ((K3 * Ed) / (k * temp2)) * std::exp(-Ed / (k * temp))) / (1 + K1 * temp - K2 + K3 * std::exp(-Ed / (k * temp)));
+}
+
+inline Real
+FuelCorrelations::theoreticalDensity(const Real alpha, const Real temp)
+{
+	const Real rho_273 = 10963.0;
+
+	return rho_273 * std::pow(alpha * (temp - 273) + 1, -3);
+}
+
+inline Real
+FuelCorrelations::solidSwelling(const Real burnup)
+{
+	return 0.0032 * burnup / 225; //eq: 5.56 from Prudil
+}
+
+inline Real
+FuelCorrelations::fissionDensity(const Real burnup, const Real density_u)
+{
+	const Real E_f = 200 * (1e6 * 1.602e-19); //MeV, energy per fission in [J]
+	return burnup * 3.6e3 * 1e6 * density_u / E_f;
+}
+
+inline Real
+FuelCorrelations::gaseousSwelling(const Real density, const Real enrichment, const Real burnup, const Real burnup_dt, const Real temp, const Real dt)
+{
+	const Real density_u = uraniumDensity(density, enrichment);
+	const Real Bu_f = fissionDensity(burnup, density_u); //number of fissions per cubic metre
+	const Real Bu_f_dt = fissionDensity(burnup_dt, density_u); //number of fissions per cubic metre per time
+
+	const Real value = std::pow((2800 - temp), 11.73) * std::exp(-0.0162 * (2800 - temp)- 8e-27 * Bu_f) * Bu_f_dt * dt; //eq: 5.57 from prudil
+
+	return 8.8e-56 * value;
+}
+
+inline Real
+FuelCorrelations::gaseousSwelling_dT(const Real density, const Real enrichment, const Real burnup, const Real burnup_dt, const Real temp)
+{
+	const Real density_u = uraniumDensity(density, enrichment);
+	const Real Bu_f = fissionDensity(burnup, density_u); //number of fissions per cubic metre
+	const Real Bu_f_dt = fissionDensity(burnup_dt, density_u); //number of fissions per cubic metre per time
+
+	const Real value = Bu_f_dt * std::exp(-0.0162 * (2800 - temp) * Bu_f) * (0.0162 * Bu_f * std::pow(2800 - temp, 11.73) - 11.73 * std::pow(2800 - temp, 10.73));
+
+	return 8.8e-56 * value;
+}
+
+inline Real
+FuelCorrelations::youngsModulus(const Real density, const Real temp)
+{
+	const Real D = density / 10963.0;
+
+	return 2.334e11 * (1 - 2.752 * (1 - D)) * (1 - 1.0915e-4 * temp);
+}
+
+inline Real
+FuelCorrelations::burnupRate(const Real q_fission, const Real ratio, const Real density_u)
+{
+	return q_fission / (3.6e3 * 1e6 * ratio * density_u); //eq: 5.26 from Prudil
+}
+
+inline Real
+FuelCorrelations::densificationRate(const Real fraction, const Real temp, const Real burnup_dt)
+{
+	const Real cd = 2.867e-2;	//kg/MWh
+	const Real bd = 8.67e-10;	//K^-3
+
+	//the argument is not allowed below zero
+	const Real argument = std::max(std::log(1 - fraction / 0.6) + bd * temp * temp * temp, 0.0);
+
+	return cd * (0.6 - fraction) * argument * burnup_dt; //eq: 5.55 from Prudil
+}
+
+inline Real
+FuelCorrelations::densificationStep(const Real fraction_old, const Real temp, const Real burnup_dt, const Real dt, Real & fraction_dT)
+{
+	const Real cd = 2.867e-2;	//kg/MWh
+	const Real bd = 8.67e-10;	//K^-3
+
+	fraction_dT = 0;
+	if (dt <= 0 || burnup_dt <= 0)
+		return fraction_old;
+
+	//F - F_old - dt rate(F) is increasing and concave in F, so Newton's method from F_old climbs to the root
+	//without overshooting it, and never reaches the 0.6 limit of the log
+	Real fraction = fraction_old;
+	Real argument = 0;
+	Real jacobian = 1;
+	for (unsigned int it = 0; it < 50; ++it)
+	{
+		argument = std::log(1 - fraction / 0.6) + bd * temp * temp * temp;
+		if (argument <= 0)
+			break; //no densification beyond the equilibrium fraction of this temperature
+
+		const Real residual = fraction - fraction_old - dt * cd * (0.6 - fraction) * argument * burnup_dt;
+		jacobian = 1 + dt * cd * (argument + 1) * burnup_dt;
+
+		const Real step = residual / jacobian;
+		fraction -= step;
+		if (std::abs(step) <= 1e-14 * (fraction + 1e-10))
+			break;
+	}
+
+	//differentiating the converged step, dF/dT = dt drate/dT / (1 - dt drate/dF)
+	if (argument > 0)
+		fraction_dT = dt * cd * (0.6 - fraction) * 3 * bd * temp * temp * burnup_dt / jacobian;
+
+	return fraction;
+}
+
+inline Real
+FuelCorrelations::densificationStrain(const Real initial_porosity, const Real fraction)
+{
+	return (1 - initial_porosity) / (1 - initial_porosity * (1 - fraction)) - 1; //eq: 5.50 from Prudil
+}
+
+#endif //FUELCORRELATIONS_H
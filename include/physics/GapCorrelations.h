@@ -0,0 +1,65 @@
+#ifndef GAPCORRELATIONS_H
+#define GAPCORRELATIONS_H
+
+#include "PhysicsConfig.h"
+
+#include <cmath>
+
+/**
+ * Heat transfer coefficients [W/(m^2 K)] across the pellet - sheath gap, eq. 5.4, 5.5 and 5.18 from Prudil.
+ */
+class GapCorrelations
+{
+public:
+  /// Conduction through the fill gas for a gap of the given width [m], eq. 5.4
+  static Real gasConduction(const Real gap_distance);
+
+  /// Conduction through the solid contact between pellet and sheath at the given contact pressure [Pa], eq. 5.5
+  static Real solidConduction(const Real temp, const Real k_fuel, const Real k_sheath, const Real contact_pressure, const Real gap_distance);
+
+  /// The constant part of eq. 5.18, sigma / (1 / e_f + 1 / e_s - 1)
+  static Real radiationFactor(const Real emissivity_fuel, const Real emissivity_sheath);
+
+  /// Radiation between surfaces at temp and gap_temp [K] and its derivative with respect to temp, eq. 5.18
+  static void radiation(const Real factor, const Real temp, const Real gap_temp, Real & h, Real & h_dT);
+};
+
+inline Real
+GapCorrelations::gasConduction(const Real gap_distance)
+{
+	const Real k_g(2.5e-3); //thermal conductivity of the gas, needs to be updated after fission gas release is implemented
+	const Real R_f(1e-6); //surface roughness of the fuel
+	const Real R_s(5e-7); //surface roughness of the sheath
+	const Real g = 5.20e-6; //jump distance of the sheath, = g_f + g_s, see p. 69
+
+	return k_g / (1.5 * (R_f + R_s) + gap_distance + g);
+}
+
+inline Real
+GapCorrelations::solidConduction(const Real temp, const Real k_fuel, const Real k_sheath, const Real contact_pressure, const Real gap_distance)
+{
+	const Real a0 = 8.6e-6;
+	const Real temp2 = temp * temp;
+	const Real H = std::exp(26.034 - 0.026394 * temp + 4.3504e-5 * temp2 - 2.5621e-8 * (temp2 * temp)); //Meyer hardness of the sheath [Pa]
+
+	return ( (2 * k_fuel * k_sheath) / (k_fuel + k_sheath) ) * 1 / (a0 * H) * std::sqrt(contact_pressure / gap_distance);
+}
+
+inline Real
+GapCorrelations::radiationFactor(const Real emissivity_fuel, const Real emissivity_sheath)
+{
+	const Real stefanboltzmann = 5.6704e-8;
+
+	return stefanboltzmann / (1 / emissivity_fuel + 1 / emissivity_sheath - 1);
+}
+
+inline void
+GapCorrelations::radiation(const Real factor, const Real temp, const Real gap_temp, Real & h, Real & h_dT)
+{
+	const Real temp2 = temp * temp;
+
+	h = factor * (temp2 + gap_temp * gap_temp) * (temp + gap_temp);
+	h_dT = factor * (3 * temp2 + gap_temp * (2 * temp + gap_temp));
+}
+
+#endif //GAPCORRELATIONS_H
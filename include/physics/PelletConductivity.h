@@ -0,0 +1,122 @@
+#ifndef PELLETCONDUCTIVITY_H
+#define PELLETCONDUCTIVITY_H
+
+#include "DualReal.h"
+
+/**
+ * Thermal conductivity of the UO2 pellets and its temperature derivative, from Prudil:
+ *
+ *   k = k0 * kappa1d * kappa1p * kappa2p * kappa4r
+ *
+ * with the Chassie unirradiated conductivity k0 and the dissolved fission product, precipitated
+ * fission product, porosity and radiation damage factors. Every factor is evaluated once on a
+ * dual number so k and dk/dT share all of their transcendental calls.
+ */
+class PelletConductivity
+{
+public:
+  /// Conductivity [W/(m K)] and its derivative with respect to temperature at temp [K], burnup [MWh/kgU] and porosity
+  static void compute(const Real temp, const Real burnup, const Real porosity, Real & k, Real & k_dT);
+
+  /// As above, with the porosity changing with temperature by porosity_dT [1/K], e.g. through densification
+  static void compute(const Real temp, const Real burnup, const Real porosity, const Real porosity_dT, Real & k, Real & k_dT);
+
+  /// Conductivity with temp (and porosity) carrying the derivative of interest
+  static DualReal conductivity(const DualReal & temp, const Real burnup, const DualReal & porosity);
+
+protected:
+  /// Unirradiated thermal conductivity
+  static DualReal chassieUnirradiated(const DualReal & temp);
+
+  /// Contribution due to dissolved fission products
+  static DualReal dissolvedFissionProducts(const DualReal & temp, const Real burnup);
+
+  /// Contribution due to precipitated (solid) fission products
+  static DualReal precipitatedFissionProducts(const DualReal & temp, const Real burnup);
+
+  /// Contribution due to pores and fission gas bubbles
+  static DualReal pores(const DualReal & temp, const DualReal & porosity);
+
+  /// Contribution due to radiation damage
+  static DualReal radiationDamage(const DualReal & temp);
+};
+
+inline void
+PelletConductivity::compute(const Real temp, const Real burnup, const Real porosity, Real & k, Real & k_dT)
+{
+	compute(temp, burnup, porosity, 0, k, k_dT);
+}
+
+inline void
+PelletConductivity::compute(const Real temp, const Real burnup, const Real porosity, const Real porosity_dT, Real & k, Real & k_dT)
+{
+	const DualReal cond = conductivity(DualReal::variable(temp), burnup, DualReal(porosity, porosity_dT));
+
+	k = cond.value();
+	k_dT = cond.derivative();
+}
+
+inline DualReal
+PelletConductivity::conductivity(const DualReal & temp, const Real burnup, const DualReal & porosity)
+{
+	return chassieUnirradiated(temp)
+		* dissolvedFissionProducts(temp, burnup)
+		* precipitatedFissionProducts(temp, burnup)
+		* pores(temp, porosity)
+		* radiationDamage(temp);
+}
+
+//Compute Unirradiated Thermal Conductivity
+inline DualReal
+PelletConductivity::chassieUnirradiated(const DualReal & temp)
+{
+	const Real A = 0.030771;			//(m K)/W
+	const Real B = 2.25e-4;				//m/W
+	const Real C = 9.28e9;				//(W K)/m
+	const Real D = 18295.09;			//K
+
+	return 1 / (A + B * temp) + C / (temp * temp) * exp(-D / temp);
+}
+
+//Compute contribution to thermal conductivity due to dissolved fission products
+inline DualReal
+PelletConductivity::dissolvedFissionProducts(const DualReal & temp, const Real burnup)
+{
+	const Real beta = burnup / 225.;	//convert to atom percent
+
+	if (beta <= 0.1)
+		return 1.0;
+
+	//m and n only depend on burnup
+	const Real m = 1.09 / std::pow(beta, 3.265);
+	const Real n = 0.0643 / std::sqrt(beta);
+
+	const DualReal x = m + n * sqrt(temp);
+
+	return x * atan(1 / x);
+}
+
+//Compute contribution to thermal conductivity due to solid fission products
+inline DualReal
+PelletConductivity::precipitatedFissionProducts(const DualReal & temp, const Real burnup)
+{
+	const Real beta = burnup / 225.;  //convert to atom percent
+
+	return 1 + ((0.019 * beta) / (3 - 0.019 * beta)) / (1 + exp(-(temp - 1200.) / 100.));
+}
+
+//Compute contribution to thermal conductivity due to pores and fission gas bubbles
+inline DualReal
+PelletConductivity::pores(const DualReal & temp, const DualReal & porosity)
+{
+	return 1.0 - (2.05 - 5.0e-4 * temp) * porosity;
+}
+
+//Compute contribution to thermal conductivity due to radiation damage
+inline DualReal
+PelletConductivity::radiationDamage(const DualReal & temp)
+{
+	return 1 - 0.2 / (1 + exp((temp - 900.) / 80.));
+}
+
+#endif //PELLETCONDUCTIVITY_H
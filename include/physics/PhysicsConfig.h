@@ -0,0 +1,24 @@
+#ifndef PHYSICSCONFIG_H
+#define PHYSICSCONFIG_H
+
+/**
+ * Common configuration of the caribou_physics headers (include/physics).
+ *
+ * Inside Caribou Real and mooseError come from MOOSE. Defining CARIBOU_PHYSICS_STANDALONE lets the
+ * correlations, the flux parameter tables and the creep model be compiled without MOOSE or libMesh,
+ * as the benchmarks in bench/ and the slice solver in slice/ do. mooseError then throws a
+ * std::runtime_error holding the message.
+ */
+#ifdef CARIBOU_PHYSICS_STANDALONE
+#include <sstream>
+#include <stdexcept>
+
+typedef double Real;
+
+#define mooseError(msg) do { std::ostringstream _error_stream; _error_stream << msg; throw std::runtime_error(_error_stream.str()); } while (0)
+#else
+#include "Moose.h"
+#include "MooseError.h"
+#endif
+
+#endif //PHYSICSCONFIG_H
@@ -0,0 +1,102 @@
+#ifndef SHEATHCORRELATIONS_H
+#define SHEATHCORRELATIONS_H
+
+#include "PhysicsConfig.h"
+
+/**
+ * Material correlations of the Zircaloy-4 sheath from Prudil (creep is in SheathCreepModel).
+ *
+ * The expansion and Young's modulus correlations are piecewise over the alpha, transition and
+ * beta phases.
+ */
+class SheathCorrelations
+{
+public:
+  /// Specific heat [J/(kg K)]
+  static Real specificHeat(const Real temp);
+
+  /// Thermal conductivity [W/(m K)], eq. 6.68
+  static Real conductivity(const Real temp);
+
+  /// Temperature derivative of the thermal conductivity
+  static Real conductivity_dT(const Real temp);
+
+  /// Axial thermal expansion strain relative to 273 K, eq. 6.61, 6.63 and 6.65
+  static Real axialThermalExpansion(const Real temp);
+
+  /// Radial thermal expansion strain relative to 273 K, eq. 6.62, 6.64 and 6.66
+  static Real radialThermalExpansion(const Real temp);
+
+  /// Young's modulus [Pa], eq. 6.60
+  static Real youngsModulus(const Real temp);
+};
+
+inline Real
+SheathCorrelations::specificHeat(const Real temp)
+{
+	Real cp = 0;
+	if (temp < 1115)
+	{
+		cp = 6.55e6 * (1.1061e-4 * temp + 0.2575);
+	}
+	else
+	{
+		cp = 2.3318e6;
+	}
+
+	//Divide by the density to get specific heat in J/kg.
+	return cp / 6551.0;
+}
+
+inline Real
+SheathCorrelations::conductivity(const Real temp)
+{
+	const Real temp2 = temp * temp;
+	const Real temp3 = temp2 * temp;
+
+	return 7.51 + 2.09e-2 * temp -1.45e-5 * temp2 + 7.67e-9 * temp3; //eq: 6.68 from Prudil
+}
+
+inline Real
+SheathCorrelations::conductivity_dT(const Real temp)
+{
+	const Real temp2 = temp * temp;
+
+	return 2.09e-2 - 2.9e-5 * temp + 23.07e-9 * temp2; //eq: 6.68 from Prudil
+}
+
+inline Real
+SheathCorrelations::axialThermalExpansion(const Real temp)
+{
+	if (temp <= 1073) 													//Alpha Phase
+		return -2.506e-5 + 4.441e-6 * (temp - 273); //eq: 6.61 from Prudil
+	else if (temp <= 1273)  										//Transition Phase
+		return 0.0120387 - 1.06387e-5 * (temp - 273); //eq: 6.65 from Prudil
+	else 																				//Beta Phase
+		return -8.3e-3 + 9.7e-6 * (temp - 273);	//eq: 6.63 from Prudil
+}
+
+inline Real
+SheathCorrelations::radialThermalExpansion(const Real temp)
+{
+	if (temp <= 1073)
+		return -2.373e-4 + 6.721e-6 * (temp - 273); //eq: 6.62 from Prudil
+	else if (temp <= 1273)
+		return 0.0140975 - 1.11975e-5 * (temp - 273); //eq: 6.66 from Prudil
+	else
+		return -6.8e-3 + 9.7e-6 * (temp - 273); //eq: 6.64 from Prudil
+}
+
+inline Real
+SheathCorrelations::youngsModulus(const Real temp)
+{
+	//eq: 6.60 from Prudil
+	if (temp < 1135)
+		return 1.148e11 - 5.99e7 * temp;
+	else if (temp < 2120)
+		return 1.005e11 - 4.725e7 * temp;
+	else
+		return 3.30e8;
+}
+
+#endif //SHEATHCORRELATIONS_H
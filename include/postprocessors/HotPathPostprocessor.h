@@ -0,0 +1,39 @@
+#ifndef HOTPATHPOSTPROCESSOR_H
+#define HOTPATHPOSTPROCESSOR_H
+
+#include "GeneralPostprocessor.h"
+
+//Forward Declarations
+class HotPathPostprocessor;
+
+template<>
+InputParameters validParams<HotPathPostprocessor>();
+
+/**
+ * Reports one of the HotPathCounters timers or counters, summed over threads and processors since
+ * the start of the run.
+ */
+class HotPathPostprocessor : public GeneralPostprocessor
+{
+public:
+  HotPathPostprocessor(const std::string & name, InputParameters parameters);
+
+  virtual void initialize() {}
+  virtual void execute();
+  virtual PostprocessorValue getValue();
+
+protected:
+  const std::string _entry;
+
+  enum Quantity
+  {
+    TIME,
+    CALLS,
+    TIME_PER_CALL
+  };
+  const Quantity _quantity;
+
+  Real _value;
+};
+
+#endif //HOTPATHPOSTPROCESSOR_H
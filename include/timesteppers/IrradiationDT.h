@@ -0,0 +1,95 @@
+#ifndef IRRADIATIONDT_H
+#define IRRADIATIONDT_H
+
+#include "TimeStepper.h"
+#include "PostprocessorInterface.h"
+
+//Forward Declarations
+class IrradiationDT;
+class Function;
+
+template<>
+InputParameters validParams<IrradiationDT>();
+
+/**
+ * Time stepper for long irradiation histories. The step grows by growth_factor every step and is
+ * limited by how fast the monitored quantities changed over the last step:
+ *
+ *   dt <= max_change / |rate|   for the burnup, creep strain, temperature and densification postprocessors
+ *
+ * so steady power runs on the largest steps the physics allows. Before every step the linear power
+ * function is sampled over the step, which is cut back to end where the power has changed by more
+ * than max_power_change, so ramps are taken in small steps (a step is never cut below 1/power_samples
+ * of the size it would have had without the ramp). Below min_power the change is measured against
+ * min_power instead of the current power, so a ramp from zero power starts with steps of a sensible
+ * size. Every step prints the quantity that set its size.
+ *
+ * The indicators are postprocessors so any measure can be used, e.g. an ElementAverageValue of the
+ * BurnupAux (or BurnupFieldAux) variable, an ElementExtremeValue of the effective creep strain of
+ * SheathMechanicalMaterial or of the temperature, and an ElementAverageValue of the densification
+ * fraction.
+ */
+class IrradiationDT :
+  public TimeStepper,
+  public PostprocessorInterface
+{
+public:
+  IrradiationDT(const std::string & name, InputParameters parameters);
+
+  virtual void init();
+  virtual void rejectStep();
+
+protected:
+  virtual Real computeInitialDT();
+  virtual Real computeDT();
+  virtual Real computeFailedDT();
+
+  /// Reasons a step ends up the size it is
+  enum Limiter
+  {
+    INITIAL,
+    GROWTH,
+    BURNUP,
+    CREEP,
+    TEMPERATURE,
+    DENSIFICATION,
+    POWER,
+    CUTBACK
+  };
+
+  /// Adds a monitored postprocessor if its parameter was given
+  void addIndicator(const std::string & param, const std::string & max_param, const Limiter limiter);
+
+  /// Shortens dt so the linear power changes by no more than max_power_change over the step
+  void limitPowerChange(Real & dt, Limiter & limiter) const;
+
+  /// Prints the step size and what set it
+  void report(const Real dt, const Limiter limiter) const;
+
+  const Real _input_dt;
+  const Real _growth_factor;
+  const Real _cutback_factor;
+
+  /// Monitored postprocessors and the largest change of each allowed in one step
+  std::vector<const PostprocessorValue *> _indicators;
+  std::vector<Real> _max_change;
+  std::vector<Limiter> _limiters;
+
+  /// Indicator values at the start of the last step
+  std::vector<Real> & _previous;
+  bool & _have_previous;
+
+  /// Step size the next step grows from, before power ramps and sync times shorten it
+  Real & _unlimited_dt;
+
+  Function * _linear_power;
+  const Real _max_power_change;
+  const unsigned int _power_samples;
+
+  /// Power the allowed change is measured against at low power [W/m], set in init() if it was not given
+  Real _min_power;
+
+  bool _cutback_occurred;
+};
+
+#endif //IRRADIATIONDT_H
@@ -0,0 +1,39 @@
+#ifndef BRANCHPOINTRECORDER_H
+#define BRANCHPOINTRECORDER_H
+
+#include "GeneralUserObject.h"
+
+//Forward Declarations
+class BranchPointRecorder;
+
+template<>
+InputParameters validParams<BranchPointRecorder>();
+
+/**
+ * Appends the checkpoint the base run writes at the branch time to its branch point file, e.g.
+ *
+ *   checkpoint = Thesis_Paraview/CANDU_base_cp/0131
+ *
+ * The Checkpoint output names its files after the time step, which an adaptive time stepper does
+ * not fix in advance, so the step is only known once the run reaches the branch time. Added by
+ * BranchPointAction (mode = save), which the branch runs then restart from this checkpoint.
+ */
+class BranchPointRecorder : public GeneralUserObject
+{
+public:
+  BranchPointRecorder(const std::string & name, InputParameters parameters);
+
+  virtual void initialize() {}
+  virtual void execute();
+  virtual void finalize() {}
+
+protected:
+  const std::string & _file_name;
+  const Real _branch_time;
+  const std::string & _checkpoint;
+  const unsigned int _padding;
+
+  bool _recorded;
+};
+
+#endif //BRANCHPOINTRECORDER_H
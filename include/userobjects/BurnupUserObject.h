@@ -0,0 +1,70 @@
+#ifndef BURNUPUSEROBJECT_H
+#define BURNUPUSEROBJECT_H
+
+#include "ElementUserObject.h"
+
+#include <map>
+#include <vector>
+
+//Forward Declarations
+class BurnupUserObject;
+class HotPathCounters;
+
+template<>
+InputParameters validParams<BurnupUserObject>();
+
+/**
+ * Advances the local burnup and its rate at every quadrature point of the pellet in a single sweep
+ * (eq. 5.26 from Prudil) and integrates the local burnup over the pellet to give the uranium mass
+ * weighted average burnup, summed across processors. FissionHeatMaterial reads the average directly
+ * (burnup_object) and BurnupFieldAux copies any of the three values into an elemental AuxVariable.
+ */
+class BurnupUserObject : public ElementUserObject
+{
+public:
+  BurnupUserObject(const std::string & name, InputParameters parameters);
+
+  virtual void initialize();
+  virtual void execute();
+  virtual void threadJoin(const UserObject & y);
+  virtual void finalize();
+
+  /// Local burnup [MWh/kgU] at a quadrature point of the given element
+  Real burnup(const Elem * elem, const unsigned int qp) const;
+
+  /// Local burnup rate [MWh/(kgU*s)] at a quadrature point of the given element
+  Real burnupRate(const Elem * elem, const unsigned int qp) const;
+
+  /// Pellet average burnup [MWh/kgU]
+  Real averageBurnup() const { return _average_burnup; }
+
+  /// Density of uranium [kg/m^3] in UO2 of the given density [kg/m^3] and enrichment [%]
+  static Real uraniumDensity(const Real density, const Real enrichment);
+
+protected:
+  /// Values stored for one element, looked up by element id
+  const std::vector<Real> & elementValues(const std::map<dof_id_type, std::vector<Real> > & values, const Elem * elem, const unsigned int qp) const;
+
+  /// Times execute() in HotPathCounters
+  HotPathCounters & _hot_path_counters;
+  const unsigned int _hot_path_timer;
+
+  /// Local burnup at the end of the previous time step
+  const VariableValue & _burnup_old;
+
+  const MaterialProperty<Real> & _density;
+  const MaterialProperty<Real> & _enrichment;
+  const MaterialProperty<Real> & _q_fission;
+  const MaterialProperty<Real> & _ratio;
+
+  std::map<dof_id_type, std::vector<Real> > _burnup;
+  std::map<dof_id_type, std::vector<Real> > _burnup_rate;
+
+  /// Integrals of uranium density times burnup, and of uranium density, over the pellet
+  Real _burnup_integral;
+  Real _uranium_mass;
+
+  Real _average_burnup;
+};
+
+#endif //BURNUPUSEROBJECT_H
@@ -0,0 +1,29 @@
+#ifndef DIAGNOSTICSWRITER_H
+#define DIAGNOSTICSWRITER_H
+
+#include "GeneralUserObject.h"
+
+//Forward Declarations
+class DiagnosticsWriter;
+
+template<>
+InputParameters validParams<DiagnosticsWriter>();
+
+/**
+ * Writes the records collected by the DiagnosticsRecorder of its application (e.g. by materials with display_values on)
+ * to <file_base>_<channel>.csv, by default at the end of every time step.
+ */
+class DiagnosticsWriter : public GeneralUserObject
+{
+public:
+  DiagnosticsWriter(const std::string & name, InputParameters parameters);
+
+  virtual void initialize() {}
+  virtual void execute();
+  virtual void finalize() {}
+
+protected:
+  const std::string _file_base;
+};
+
+#endif //DIAGNOSTICSWRITER_H
@@ -0,0 +1,99 @@
+#ifndef FUELPERFORMANCEREPORTER_H
+#define FUELPERFORMANCEREPORTER_H
+
+#include "GeneralUserObject.h"
+
+#include <fstream>
+
+//Forward Declarations
+class FuelPerformanceReporter;
+class BurnupUserObject;
+
+namespace libMesh
+{
+class System;
+}
+
+template<>
+InputParameters validParams<FuelPerformanceReporter>();
+
+/**
+ * Writes the fuel performance metrics operations need to one CSV row per time step, so that full
+ * field Exodus output can be written at a much sparser cadence:
+ *
+ *   time,centreline_temp,pellet_surface_temp,sheath_inner_temp,sheath_outer_temp,gap_conductance,sheath_hoop_strain,average_burnup
+ *
+ * The temperatures and the radial displacement of the sheath mid-wall are sampled at one axial
+ * position (r along x, the axis along y for RZ or z in 3D). The gap conductance is the
+ * gap_conductance property of GapHeatConductanceMaterial, copied into an elemental aux variable
+ * (e.g. by MaterialRealAux) and sampled at the pellet surface. The average burnup comes from a
+ * BurnupUserObject. Metrics whose inputs are not given are left out of the file.
+ *
+ * Profiles of any variables along named lines are written to <file_base>_<profile>.csv every
+ * profile_interval steps, one row per point:
+ *
+ *   time,step,distance,x,y,z,<variables>
+ */
+class FuelPerformanceReporter : public GeneralUserObject
+{
+public:
+  FuelPerformanceReporter(const std::string & name, InputParameters parameters);
+  virtual ~FuelPerformanceReporter();
+
+  virtual void initialSetup();
+
+  virtual void initialize() {}
+  virtual void execute();
+  virtual void finalize() {}
+
+protected:
+  /// A variable and the system holding it
+  struct Sampled
+  {
+    const libMesh::System * system;
+    unsigned int number;
+  };
+
+  Sampled findVariable(const VariableName & name) const;
+
+  /// Value of a variable at a point, on every processor
+  Real sample(const Sampled & variable, const Point & point) const;
+
+  /// Point at radius r on the sampled axial position
+  Point radialPoint(const Real r) const;
+
+  void writeMetrics();
+  void writeProfiles();
+
+  const std::string _file_base;
+
+  const Real _pellet_radius;
+  const Real _sheath_inner_radius;
+  const Real _sheath_outer_radius;
+  const Real _centreline_radius;
+  const Real _axial_position;
+  const bool _axial_z;
+
+  const BurnupUserObject * const _burnup_object;
+
+  Sampled _temp;
+  Sampled _disp_r;
+  bool _has_disp_r;
+  Sampled _gap_conductance;
+  bool _has_gap_conductance;
+
+  /// Profile names, their end points and the variables sampled along them
+  std::vector<std::string> _profiles;
+  std::vector<Point> _profile_start;
+  std::vector<Point> _profile_end;
+  const unsigned int _profile_points;
+  const unsigned int _profile_interval;
+  const std::vector<VariableName> _profile_variable_names;
+  std::vector<Sampled> _profile_variables;
+
+  /// Only open on processor 0
+  std::ofstream _file;
+  std::vector<std::ofstream *> _profile_files;
+};
+
+#endif //FUELPERFORMANCEREPORTER_H
@@ -0,0 +1,43 @@
+#ifndef HOTPATHLOG_H
+#define HOTPATHLOG_H
+
+#include "GeneralUserObject.h"
+
+//Forward Declarations
+class HotPathLog;
+
+template<>
+InputParameters validParams<HotPathLog>();
+
+/**
+ * Prints the HotPathCounters timers and counters as a perf log style table, every print_interval
+ * time steps and once more when the run ends (like the libMesh perf log).
+ */
+class HotPathLog : public GeneralUserObject
+{
+public:
+  HotPathLog(const std::string & name, InputParameters parameters);
+  virtual ~HotPathLog();
+
+  virtual void initialize() {}
+  virtual void execute();
+  virtual void finalize() {}
+
+protected:
+  /// Writes the last collected totals
+  void print() const;
+
+  const unsigned int _print_interval;
+
+  /// Totals over all processors from the last execution, with the names copied so that the
+  /// table can still be printed after the application has released its counters
+  std::vector<std::string> _names;
+  std::vector<bool> _is_timer;
+  std::vector<Real> _seconds;
+  std::vector<Real> _calls;
+  Real _wall_time;
+
+  const double _start;
+};
+
+#endif //HOTPATHLOG_H
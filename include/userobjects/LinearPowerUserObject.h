@@ -0,0 +1,92 @@
+#ifndef LINEARPOWERUSEROBJECT_H
+#define LINEARPOWERUSEROBJECT_H
+
+#include "GeneralUserObject.h"
+#include "FluxParameterTable.h"
+
+#include <vector>
+
+//Forward Declarations
+class LinearPowerUserObject;
+class BurnupUserObject;
+class Function;
+
+template<>
+InputParameters validParams<LinearPowerUserObject>();
+
+/**
+ * Evaluates the quantities of the fission heat source that are uniform over the pellet once per
+ * execution (every time step by default) instead of at every quadrature point:
+ *
+ *   - the linear power, once for the rod or, when the power function varies along the axis, once
+ *     per axial segment (axial_segments equal slices from axial_min to axial_max, evaluated at their
+ *     middle)
+ *   - the uranium mass per unit length of the pellet
+ *   - with a burnup_object, the flux parameters at the pellet average burnup and the denominator of
+ *     eq. 5.23 from Prudil that normalises the radial profile
+ *
+ * FissionHeatMaterial and AverageBurnupAux read them through their power_object parameter. The linear
+ * power only depends on time and is evaluated when the step starts, before any material of the step,
+ * BurnupUserObject's included. GeneralUserObjects run after the ElementUserObjects of the same
+ * execute_on, so the flux parameters follow the average burnup of this step.
+ */
+class LinearPowerUserObject : public GeneralUserObject
+{
+public:
+  LinearPowerUserObject(const std::string & name, InputParameters parameters);
+
+  virtual void initialSetup();
+  virtual void timestepSetup();
+
+  virtual void initialize() {}
+  virtual void execute();
+  virtual void finalize() {}
+
+  /// Linear power [W/m] of the axial segment holding the point
+  Real linearPower(const Point & point) const { return _linear_power_values[segment(point)]; }
+
+  /// Uranium mass per unit length of the pellet [kgU/m]
+  Real uraniumMassPerLength() const { return _uranium_mass_per_length; }
+
+  /// Are the flux parameters evaluated here (a burnup_object was given)?
+  bool hasFluxParameters() const { return _burnup_object != NULL; }
+
+  /// Flux parameters at the pellet average burnup and the denominator of eq. 5.23
+  void fluxParameters(Real & beta, Real & kappa, Real & lambda, Real & denominator) const;
+
+  Real pelletRadius() const { return _pellet_radius; }
+  Real enrichment() const { return _enrichment; }
+
+protected:
+  /// Linear power of every segment at the current time
+  void updateLinearPower();
+
+  /// Flux parameters and profile denominator at the current pellet average burnup
+  void updateFluxParameters();
+
+  /// Axial segment of a point, the end segments extend past axial_min and axial_max
+  unsigned int segment(const Point & point) const;
+
+  Function & _linear_power;
+  const BurnupUserObject * const _burnup_object;
+
+  const unsigned int _axial_component;
+  const unsigned int _axial_segments;
+  const Real _axial_min;
+  const Real _axial_max;
+
+  const Real _pellet_radius;
+  const Real _enrichment;
+  const Real _uranium_mass_per_length;
+
+  //beta, kappa and lambda as functions of burnup, only built with a burnup_object
+  FluxParameterTable _flux_table;
+
+  std::vector<Real> _linear_power_values;
+  Real _beta;
+  Real _kappa;
+  Real _lambda;
+  Real _denominator;
+};
+
+#endif //LINEARPOWERUSEROBJECT_H
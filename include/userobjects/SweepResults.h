@@ -0,0 +1,44 @@
+#ifndef SWEEPRESULTS_H
+#define SWEEPRESULTS_H
+
+#include "GeneralUserObject.h"
+
+#include <fstream>
+
+//Forward Declarations
+class SweepResults;
+class ParameterSweepMultiApp;
+
+template<>
+InputParameters validParams<SweepResults>();
+
+/**
+ * Collects postprocessor values from every sub-app of a ParameterSweepMultiApp, wherever it runs,
+ * and writes them to one CSV file with a row per variant and time step, next to the parameter
+ * values of the variant.
+ */
+class SweepResults : public GeneralUserObject
+{
+public:
+  SweepResults(const std::string & name, InputParameters parameters);
+
+  virtual void initialSetup();
+
+  virtual void initialize() {}
+  virtual void execute();
+  virtual void finalize() {}
+
+protected:
+  /// Writes the header of the file
+  void writeHeader();
+
+  const std::vector<PostprocessorName> & _postprocessors;
+
+  /// The MultiApps are built after the UserObjects, so this is only set in initialSetup()
+  ParameterSweepMultiApp * _sweep;
+
+  /// Only open on processor 0
+  std::ofstream _file;
+};
+
+#endif //SWEEPRESULTS_H
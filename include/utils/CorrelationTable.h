@@ -0,0 +1,161 @@
+#ifndef CORRELATIONTABLE_H
+#define CORRELATIONTABLE_H
+
+#include "Moose.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * Piecewise linear cache of a material correlation that only depends on temperature.
+ *
+ * The correlation is sampled once on a uniform grid per segment, with segments split at the
+ * phase-transition breakpoints so no interval straddles a jump or kink. Each segment is refined
+ * until the interpolation error at the quarter points of every interval is below half of the
+ * requested relative tolerance, and then until the error at 64 evenly spaced points inside every
+ * interval is below the tolerance itself. The tolerance therefore bounds the error everywhere
+ * except for features of the correlation narrower than 1/64 of an interval. The error is relative
+ * to max(|exact|, 1e-6 * the segment's largest value), so values crossing zero (e.g. a thermal
+ * expansion) are held to an absolute error of 1e-6 times the tolerance times that largest value.
+ *
+ * Temperatures outside of the table and exactly on a breakpoint are passed to the correlation,
+ * so the table never changes which branch of a piecewise correlation is taken. In check mode
+ * every lookup is compared with the correlation and errors out if the tolerance is not met.
+ */
+class CorrelationTable
+{
+public:
+  /// A temperature dependent correlation
+  class Correlation
+  {
+  public:
+    virtual ~Correlation() {}
+    virtual Real value(const Real temp) const = 0;
+  };
+
+  /// Adapts a member function of a material, e.g. &SheathThermalMaterial::computeSpecificHeat
+  template<typename T>
+  class MemberCorrelation : public Correlation
+  {
+  public:
+    MemberCorrelation(T & object, Real (T::*function)(const Real)) : _object(object), _function(function) {}
+    virtual Real value(const Real temp) const { return (_object.*_function)(temp); }
+
+  protected:
+    T & _object;
+    Real (T::*_function)(const Real);
+  };
+
+  CorrelationTable();
+  ~CorrelationTable();
+
+  /**
+   * Sample the correlation (which the table takes ownership of) between temp_min and temp_max [K].
+   * The breakpoints do not need to lie inside the range.
+   */
+  void build(const std::string & name, Correlation * correlation,
+             const Real temp_min, const Real temp_max,
+             const std::vector<Real> & breakpoints, const Real tolerance);
+
+  /// Convenience overload for a member function of a material
+  template<typename T>
+  void build(const std::string & name, T & object, Real (T::*function)(const Real),
+             const Real temp_min, const Real temp_max,
+             const std::vector<Real> & breakpoints, const Real tolerance)
+  {
+    build(name, new MemberCorrelation<T>(object, function), temp_min, temp_max, breakpoints, tolerance);
+  }
+
+  /// Compare every lookup against the correlation
+  void setCheck(const bool check) { _check = check; }
+
+  /// Has build() been called?
+  bool built() const { return _correlation != NULL; }
+
+  /// Number of tabulated values, over all segments
+  unsigned int size() const { return _values.size(); }
+
+  /// Error of the tabulated value at temp, measured as above (0 where the correlation is used directly)
+  Real error(const Real temp) const;
+
+  /// Interpolated value of the correlation at temp [K]
+  Real value(const Real temp) const
+  {
+    if (_check)
+      return checkedValue(temp);
+
+    if (temp <= _temp_min || temp >= _temp_max)
+      return _correlation->value(temp);
+
+    const Segment & segment = locate(temp);
+    if (temp == segment.start)
+      return _correlation->value(temp);
+
+    return interpolate(segment, temp);
+  }
+
+protected:
+  struct Segment
+  {
+    Real start;
+    Real inv_spacing;
+    unsigned int offset;
+    unsigned int n_intervals;
+
+    /// Largest magnitude in the segment, used to measure the error near zero crossings
+    Real scale;
+  };
+
+  /// Segment containing a temperature inside of the table
+  const Segment & locate(const Real temp) const
+  {
+    unsigned int s = 0;
+    while (s + 1 < _segments.size() && temp >= _segments[s + 1].start)
+      ++s;
+    return _segments[s];
+  }
+
+  /// Linear interpolation within a segment
+  Real interpolate(const Segment & segment, const Real temp) const
+  {
+    const Real x = (temp - segment.start) * segment.inv_spacing;
+    unsigned int i = static_cast<unsigned int>(x);
+    if (i >= segment.n_intervals)
+      i = segment.n_intervals - 1;
+
+    const Real * v = &_values[segment.offset + i];
+    return v[0] + (x - i) * (v[1] - v[0]);
+  }
+
+  /// Interpolate, compare against the correlation and return the interpolated value
+  Real checkedValue(const Real temp) const;
+
+  /// Sample one segment, doubling the number of intervals until the tolerance is met
+  void buildSegment(const Real start, const Real end);
+
+  /// Largest error over the given number of evenly spaced points inside every interval of a segment
+  Real maxError(const std::vector<Real> & nodes, const Real start, const Real h, const Real scale,
+                const unsigned int points, const Real limit) const;
+
+  /// Error of an approximation measured as described above
+  Real error(const Real approximate, const Real exact, const Real scale) const;
+
+  std::string _name;
+  Correlation * _correlation;
+
+  Real _temp_min;
+  Real _temp_max;
+  Real _tolerance;
+  bool _check;
+
+  std::vector<Segment> _segments;
+
+  /// Node values of all segments, one after the other
+  std::vector<Real> _values;
+
+private:
+  CorrelationTable(const CorrelationTable &);
+  CorrelationTable & operator=(const CorrelationTable &);
+};
+
+#endif //CORRELATIONTABLE_H
@@ -0,0 +1,65 @@
+#ifndef DIAGNOSTICSCHANNEL_H
+#define DIAGNOSTICSCHANNEL_H
+
+#include "InputParameters.h"
+#include "DiagnosticsRecorder.h"
+
+class DiagnosticsChannel;
+
+template<>
+InputParameters validParams<DiagnosticsChannel>();
+
+/**
+ * Sampling front end of DiagnosticsRecorder, held by an object that wants to record values:
+ *
+ *   if (_diagnostics.sample(_t_step))
+ *   {
+ *     const Real values[] = {...};
+ *     _diagnostics.record(_t, _t_step, values);
+ *   }
+ *
+ * Only every diagnostics_interval-th evaluation on every diagnostics_step_interval-th time step is
+ * recorded. A disabled channel costs a single branch.
+ */
+class DiagnosticsChannel
+{
+public:
+  DiagnosticsChannel(const bool enabled, const InputParameters & parameters, const MooseApp & app, const THREAD_ID tid);
+
+  /// Register the channel's fields; nothing is registered if the channel is disabled
+  void init(const std::string & name, const char * const * fields, const unsigned int n_fields);
+
+  bool enabled() const { return _enabled; }
+
+  /// Should this evaluation be recorded?
+  bool sample(const int t_step)
+  {
+    if (!_enabled || t_step % _step_interval != 0)
+      return false;
+
+    if (++_count < _interval)
+      return false;
+
+    _count = 0;
+    return true;
+  }
+
+  void record(const Real time, const int t_step, const Real * values)
+  {
+    _recorder.record(_channel, _tid, time, t_step, values);
+  }
+
+protected:
+  const bool _enabled;
+  const unsigned int _interval;
+  const int _step_interval;
+  const THREAD_ID _tid;
+
+  /// The recorder of the application the owning object belongs to
+  DiagnosticsRecorder & _recorder;
+
+  unsigned int _channel;
+  unsigned int _count;
+};
+
+#endif //DIAGNOSTICSCHANNEL_H
@@ -0,0 +1,100 @@
+#ifndef DIAGNOSTICSRECORDER_H
+#define DIAGNOSTICSRECORDER_H
+
+#include "Moose.h"
+#include "MooseTypes.h"
+
+#include <string>
+#include <vector>
+
+class MooseApp;
+
+/**
+ * Store of diagnostic records, one per application so that sub-apps running in the same process
+ * (e.g. the variants of a ParameterSweepMultiApp) keep their own channels and buffer sizes.
+ *
+ * Each channel (usually one per material) has a fixed set of fields and one ring buffer per thread,
+ * so recording from a threaded loop needs no locking and never allocates. When a buffer is full the
+ * oldest records are overwritten and counted as dropped. DiagnosticsWriter flushes every channel to
+ * <file_base>_<channel>.csv at the end of each time step, one row per record:
+ *
+ *   time,step,thread,<fields>
+ */
+class DiagnosticsRecorder
+{
+public:
+  /// The recorder of an application, created on first use
+  static DiagnosticsRecorder & instance(const MooseApp & app);
+
+  /// Destroy the recorder of an application, called when the application is destroyed
+  static void release(const MooseApp & app);
+
+  /// Register a channel, or return the existing one of the same name (thread copies of a material share a channel)
+  unsigned int addChannel(const std::string & name, const std::vector<std::string> & fields);
+
+  /// Number of records kept per channel and thread, existing buffers are emptied
+  void setCapacity(const unsigned int capacity);
+
+  /// Store one record; values holds one entry per field of the channel
+  void record(const unsigned int channel, const THREAD_ID tid, const Real time, const int t_step, const Real * values)
+  {
+    Channel & c = _channels[channel];
+    RingBuffer & buffer = c.buffers[tid];
+
+    const unsigned int width = c.fields.size() + 2;
+    const unsigned int slot = (buffer.head + buffer.size) % _capacity;
+    Real * row = &buffer.data[slot * width];
+
+    row[0] = time;
+    row[1] = t_step;
+    for (unsigned int i = 0; i + 2 < width; ++i)
+      row[i + 2] = values[i];
+
+    if (buffer.size < _capacity)
+      ++buffer.size;
+    else
+    {
+      buffer.head = (buffer.head + 1) % _capacity;
+      ++buffer.dropped;
+    }
+  }
+
+  /**
+   * Append all buffered records to the channel files and empty the buffers. With more than one
+   * processor each writes its own files, suffixed with the processor id.
+   * Returns the number of records that were overwritten before they could be written.
+   */
+  unsigned long flush(const std::string & file_base, const unsigned int processor_id, const unsigned int n_processors);
+
+protected:
+  DiagnosticsRecorder();
+
+  struct RingBuffer
+  {
+    RingBuffer() : head(0), size(0), dropped(0) {}
+
+    std::vector<Real> data;
+    unsigned int head;
+    unsigned int size;
+    unsigned long dropped;
+  };
+
+  struct Channel
+  {
+    Channel() : started(false) {}
+
+    std::string name;
+    std::vector<std::string> fields;
+    std::vector<RingBuffer> buffers;
+
+    /// Has the file been created (and its header written)?
+    bool started;
+  };
+
+  void allocate(Channel & channel);
+
+  std::vector<Channel> _channels;
+  unsigned int _capacity;
+};
+
+#endif //DIAGNOSTICSRECORDER_H
@@ -0,0 +1,57 @@
+#ifndef ELASTICITYTENSORCACHE_H
+#define ELASTICITYTENSORCACHE_H
+
+#include "Moose.h"
+
+class SymmElasticityTensor;
+class SymmIsotropicElasticityTensor;
+
+/**
+ * Skips rebuilding the isotropic elasticity tensor of a SolidModel when its inputs have not changed.
+ *
+ * SolidModel keeps one tensor per material and only recalculates it when updateElasticityTensor()
+ * returns true, so a material that returns false keeps the tensor of the last build. The inputs
+ * (temperature and density) are snapped to bins, the moduli are evaluated at the bin centres, and
+ * the tensor is only rebuilt when a quadrature point falls into a different bin than the last one.
+ * Binning, rather than comparing with the last point, gives every point the same tensor whatever
+ * order the points are visited in, so results do not depend on the partitioning or threads. A bin
+ * width of zero keeps the exact input, and the tensor is then only reused for identical inputs.
+ *
+ *   if (!_elasticity_cache.changed(tensor, temp, density))
+ *     return false;
+ *   _elasticity_cache.build(computeYoungsModulus(density, temp), poissons_ratio);
+ *   return true;
+ */
+class ElasticityTensorCache
+{
+public:
+  /// Widths of the temperature [K] and relative density bins
+  ElasticityTensorCache(const Real temp_bin, const Real density_bin = 0);
+
+  /**
+   * Snap the inputs to their bins. Returns false if they fall into the bins of the last build of
+   * the same tensor, in which case it is still valid. The tensor has to be a SymmIsotropicElasticityTensor.
+   */
+  bool changed(SymmElasticityTensor & tensor, Real & temp, Real & density);
+  bool changed(SymmElasticityTensor & tensor, Real & temp);
+
+  /// Set the moduli of the tensor passed to the last changed() call
+  void build(const Real youngs_modulus, const Real poissons_ratio);
+
+protected:
+  /// Bin centre of x, or x itself for a zero width
+  static Real snap(const Real x, const Real width);
+
+  const Real _temp_bin;
+  const Real _density_bin;
+
+  bool _built;
+  Real _temp;
+  Real _density;
+
+  /// The tensor SolidModel hands in is the same object at every call, so it is only cast once
+  SymmElasticityTensor * _tensor;
+  SymmIsotropicElasticityTensor * _isotropic;
+};
+
+#endif //ELASTICITYTENSORCACHE_H
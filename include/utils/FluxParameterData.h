@@ -0,0 +1,77 @@
+#ifndef FLUXPARAMETERDATA_H
+#define FLUXPARAMETERDATA_H
+
+#include "PhysicsConfig.h"
+
+#include <string>
+
+/**
+ * Read-only set of flux parameter tables (beta, kappa and lambda) on a radius x enrichment x burnup grid.
+ *
+ * The grids may be of any size. Each table is stored contiguously as [radius][burnup][enrichment].
+ * Data either comes from the tables compiled into Caribou or from a binary file, which is memory
+ * mapped once per process and shared by every thread and material that names it.
+ *
+ * Binary file layout (native byte order):
+ *   char[8]   magic "CRBFLUX1"
+ *   uint32    version (1)
+ *   uint32    number of radii, enrichments and burnups
+ *   uint32[2] reserved
+ *   double    radius grid [m], enrichment grid [%], burnup grid [MWh/kgU]
+ *   double    beta, kappa and lambda tables
+ * scripts/flux_table_converter.py writes this format from a CSV file.
+ */
+class FluxParameterData
+{
+public:
+  /// The tables compiled into Caribou (pellet radii of 4, 6.075 and 9 mm)
+  static const FluxParameterData & builtin();
+
+  /// Tables read from a binary file, mapped on the first request and shared afterwards
+  static const FluxParameterData & fromFile(const std::string & file_name);
+
+  ~FluxParameterData();
+
+  unsigned int nRadius() const { return _n_radius; }
+  unsigned int nEnrichment() const { return _n_enrichment; }
+  unsigned int nBurnup() const { return _n_burnup; }
+
+  const double * radius() const { return _radius; }
+  const double * enrichment() const { return _enrichment; }
+  const double * burnup() const { return _burnup; }
+
+  const double * beta() const { return _beta; }
+  const double * kappa() const { return _kappa; }
+  const double * lambda() const { return _lambda; }
+
+  /// Where the data came from, used in error messages
+  const std::string & source() const { return _source; }
+
+protected:
+  FluxParameterData();
+
+  /// Maps a file and points the grids and tables into it
+  void map(const std::string & file_name);
+
+  /// Checks that every grid is strictly increasing
+  void checkGrids() const;
+
+  std::string _source;
+
+  unsigned int _n_radius;
+  unsigned int _n_enrichment;
+  unsigned int _n_burnup;
+
+  const double * _radius;
+  const double * _enrichment;
+  const double * _burnup;
+
+  const double * _beta;
+  const double * _kappa;
+  const double * _lambda;
+
+  void * _mapping;
+  std::size_t _mapping_size;
+};
+
+#endif //FLUXPARAMETERDATA_H
@@ -0,0 +1,58 @@
+#ifndef FLUXPARAMETERTABLE_H
+#define FLUXPARAMETERTABLE_H
+
+#include "PhysicsConfig.h"
+
+#include <vector>
+
+class FluxParameterData;
+
+/**
+ * Lookup engine for the flux depression constants (beta, kappa and lambda) of eq. 5.20 from Prudil.
+ *
+ * The tabulated data (see FluxParameterData) is indexed by pellet radius, enrichment and average
+ * burnup. Radius and enrichment are fixed for a run, so both dimensions are collapsed once when the
+ * table is built, leaving a single burnup curve holding all three constants side by side.
+ */
+class FluxParameterTable
+{
+public:
+  FluxParameterTable();
+
+  /**
+   * Collapse the tabulated data onto a single burnup curve for the given pellet radius [m]
+   * and enrichment [%]. Errors out if either value lies outside of the tabulated range.
+   */
+  void build(const Real pellet_radius, const Real enrichment, const FluxParameterData & data);
+
+  /// Has build() been called?
+  bool built() const { return !_burnup.empty(); }
+
+  /// Interpolate beta, kappa and lambda at the given average burnup [MWh/kgU]
+  void lookup(const Real burnup, Real & beta, Real & kappa, Real & lambda) const;
+
+protected:
+  /**
+   * Collapse one set of tables (stored as [radius][burnup][enrichment]) onto the burnup grid,
+   * writing into the interleaved value array at the given offset.
+   */
+  void collapse(const double * data, const unsigned int offset,
+                const unsigned int r_index, const Real r_weight,
+                const unsigned int e_index, const Real e_weight,
+                const unsigned int n_e);
+
+  /// Locates the interval of a sorted grid containing x and the linear weight within it
+  static void bracket(const std::vector<Real> & grid, const Real x, unsigned int & index, Real & weight);
+
+  /// Burnup grid [MWh/kgU]
+  std::vector<Real> _burnup;
+
+  /// Interleaved (beta, kappa, lambda) values at each burnup grid point
+  std::vector<Real> _values;
+
+  /// Uniform burnup grids are indexed directly rather than searched
+  bool _uniform;
+  Real _inv_spacing;
+};
+
+#endif //FLUXPARAMETERTABLE_H
@@ -0,0 +1,123 @@
+#ifndef HOTPATHCOUNTERS_H
+#define HOTPATHCOUNTERS_H
+
+#include "Moose.h"
+#include "MooseTypes.h"
+
+#include <string>
+#include <vector>
+
+class MooseApp;
+
+/**
+ * Timers and event counters for the hot paths of the Caribou objects, one set per application so
+ * that sub-apps running in the same process (e.g. the variants of a ParameterSweepMultiApp) are
+ * reported separately.
+ *
+ * Every material, kernel and aux kernel registers a timer under its system and name when it is built
+ * (thread copies share it), e.g. "Materials/fission_heat", and wraps its compute calls in a HotPathTimer.
+ * Iterative parts register counters, e.g. "Materials/<name>/creep_iterations". The system keeps an aux
+ * kernel and a user object (or a kernel and a material) of the same name apart. Each thread
+ * accumulates into its own slots, so nothing is locked while computing. Nothing is timed unless an
+ * output object (HotPathPostprocessor or HotPathLog) has switched the counters on.
+ */
+class HotPathCounters
+{
+public:
+  /// The counters of an application, created on first use
+  static HotPathCounters & instance(const MooseApp & app);
+
+  /// Destroy the counters of an application, called when the application is destroyed
+  static void release(const MooseApp & app);
+
+  /// Register the timer <system>/<name>, or return the existing one of the same name
+  unsigned int addTimer(const std::string & system, const std::string & name) { return addEntry(system + "/" + name, true); }
+
+  /// Register the event counter <system>/<name>, or return the existing one of the same name
+  unsigned int addCounter(const std::string & system, const std::string & name) { return addEntry(system + "/" + name, false); }
+
+  /// Switch the timers and counters on, called by the objects that report them
+  void enable() { _enabled = true; }
+  bool enabled() const { return _enabled; }
+
+  /// Add a timed call to a timer
+  void addTime(const unsigned int id, const THREAD_ID tid, const double seconds)
+  {
+    Entry & entry = _entries[tid][id];
+    entry.seconds += seconds;
+    ++entry.calls;
+  }
+
+  /// Add n events to a counter
+  void count(const unsigned int id, const THREAD_ID tid, const unsigned long n = 1)
+  {
+    if (_enabled)
+      _entries[tid][id].calls += n;
+  }
+
+  /// Number of registered timers and counters
+  unsigned int size() const { return _names.size(); }
+
+  /// Index of the named timer or counter, size() if there is none
+  unsigned int find(const std::string & name) const;
+
+  const std::string & name(const unsigned int id) const { return _names[id]; }
+  bool isTimer(const unsigned int id) const { return _is_timer[id]; }
+
+  /// Seconds and calls (or events) summed over the threads of this processor
+  void totals(const unsigned int id, Real & seconds, Real & calls) const;
+
+  /// Monotonic wall clock [s]
+  static double now();
+
+protected:
+  HotPathCounters();
+
+  unsigned int addEntry(const std::string & name, const bool is_timer);
+
+  struct Entry
+  {
+    Entry() : seconds(0), calls(0) {}
+
+    double seconds;
+    unsigned long calls;
+  };
+
+  /// Slots per thread, each padded so that two threads never write to the same cache line
+  std::vector<std::vector<Entry> > _entries;
+
+  std::vector<std::string> _names;
+  std::vector<bool> _is_timer;
+
+  bool _enabled;
+};
+
+/**
+ * Times the scope it lives in and adds it to a HotPathCounters timer. Only reads the clock when
+ * the counters are switched on.
+ */
+class HotPathTimer
+{
+public:
+  HotPathTimer(HotPathCounters & counters, const unsigned int id, const THREAD_ID tid) :
+    _counters(counters),
+    _id(id),
+    _tid(tid),
+    _start(counters.enabled() ? HotPathCounters::now() : -1)
+  {
+  }
+
+  ~HotPathTimer()
+  {
+    if (_start >= 0)
+      _counters.addTime(_id, _tid, HotPathCounters::now() - _start);
+  }
+
+protected:
+  HotPathCounters & _counters;
+  const unsigned int _id;
+  const THREAD_ID _tid;
+  const double _start;
+};
+
+#endif //HOTPATHCOUNTERS_H
@@ -0,0 +1,52 @@
+#ifndef RADIALPOWERPROFILE_H
+#define RADIALPOWERPROFILE_H
+
+#include "PhysicsConfig.h"
+
+/**
+ * Radial power profile of a fuel pellet, eq. 5.20 and 5.23 from Prudil (with the middle term set to zero):
+ *
+ *   Q(r) = P / (2 pi) * (I0(kappa r) + beta exp(lambda (r - R))) / ((R / kappa) I1(kappa R) + beta (R / lambda + (exp(-lambda R) - 1) / lambda^2))
+ *
+ * The Bessel functions use the polynomial fits taken from HORSE - QFission. The batched
+ * evaluation works on a whole element's worth of points at once and uses AVX-512 or AVX2 when
+ * Caribou is compiled with them enabled (e.g. -march=native), with a scalar fallback otherwise.
+ */
+class RadialPowerProfile
+{
+public:
+  /// Modified Bessel function of the first kind, order zero
+  static Real besselI0(const Real x);
+
+  /// Modified Bessel function of the first kind, order one
+  static Real besselI1(const Real x);
+
+  /**
+   * Profile factor (I0(kappa r) + beta exp(lambda (r - R))) / denominator of eq. 5.23 at a single point,
+   * the volumetric heat generation is P / (2 pi) times this factor
+   */
+  static Real profile(const Real r, const Real kappa, const Real beta, const Real lambda, const Real R);
+
+  /// Denominator of eq. 5.23, the same for every point that shares the flux parameters
+  static Real denominator(const Real kappa, const Real beta, const Real lambda, const Real R);
+
+  /**
+   * Profile factor at n points, each with its own flux parameters. The arrays do not need to be aligned.
+   */
+  static void profile(const unsigned int n, const Real * r,
+                      const Real * kappa, const Real * beta, const Real * lambda,
+                      const Real R, Real * out);
+
+  /**
+   * Profile factor at n points sharing one set of flux parameters, with the denominator computed
+   * once beforehand (see LinearPowerUserObject), so only the shape is evaluated per point
+   */
+  static void profile(const unsigned int n, const Real * r,
+                      const Real kappa, const Real beta, const Real lambda,
+                      const Real R, const Real denominator, Real * out);
+
+  /// Number of points evaluated together by the vectorized kernel (1 for the scalar fallback)
+  static unsigned int simdWidth();
+};
+
+#endif //RADIALPOWERPROFILE_H
@@ -0,0 +1,68 @@
+#ifndef SHEATHCREEPMODEL_H
+#define SHEATHCREEPMODEL_H
+
+#include "PhysicsConfig.h"
+
+/**
+ * Diffusional (grain boundary sliding) creep of the Zircaloy sheath, eq. 6.67 from Prudil:
+ *
+ *   edot = F (sigma / d)^m exp(-Q / T),   F = 6.34e6 / G^2,   G = 1000 (36.3 - 0.0223 (T - 273))
+ *
+ * with sigma in MPa and m, d [um] and Q depending on the alpha, transition or beta phase. All of the
+ * temperature dependence is gathered into edot = A sigma^m, so the rate and its derivative cost a
+ * single pow once A and m are known.
+ *
+ * integrate() solves the radial return for the effective creep strain increment del_p,
+ *
+ *   A (sigma_trial - 3 mu del_p)^m = del_p / dt,
+ *
+ * in terms of the relaxed stress s = sigma_trial - 3 mu del_p. The residual s + 3 mu dt A s^m - sigma_trial
+ * is increasing and convex in s, and both sigma_trial and the pure power law estimate (sigma_trial / (3 mu dt A))^(1/m)
+ * bound the root from above. Newton's method started from the smaller of the two therefore converges
+ * monotonically; a bisection safeguard keeps the iterates inside [0, s] against round off.
+ */
+class SheathCreepModel
+{
+public:
+  /// Temperature dependent part of the creep law, edot = A sigma^m
+  struct Coefficients
+  {
+    Real A;
+    Real m;
+  };
+
+  SheathCreepModel(const Real relative_tolerance, const Real absolute_tolerance, const unsigned int max_its);
+
+  /// Coefficients of the creep law at temperature temp [K]
+  static Coefficients coefficients(const Real temp);
+
+  /// Creep rate [1/s] and its derivative with respect to the stress sigma [MPa]
+  static void rate(const Coefficients & c, const Real sigma, Real & edot, Real & dedot_dsigma);
+
+  /**
+   * Effective creep strain increment over dt for a trial effective stress [Pa] and shear modulus [Pa].
+   * The residual (creep rate - del_p / dt) is returned so that a failure can be reported.
+   * Returns false if the tolerances were not met in max_its iterations.
+   */
+  bool integrate(const Real temp, const Real trial_stress, const Real shear_modulus, const Real dt,
+                 Real & del_p, unsigned int & its, Real & residual) const;
+
+  /**
+   * The same for n points at once. The temperature dependent coefficients are evaluated in one pass
+   * before the points are solved. Returns the number of points that did not converge.
+   */
+  unsigned int integrate(const unsigned int n, const Real * temp, const Real * trial_stress,
+                         const Real shear_modulus, const Real dt,
+                         Real * del_p, unsigned int * its, Real * residual) const;
+
+protected:
+  /// Solve a single point once its coefficients are known
+  bool solve(const Coefficients & c, const Real trial_stress, const Real shear_modulus, const Real dt,
+             Real & del_p, unsigned int & its, Real & residual) const;
+
+  const Real _relative_tolerance;
+  const Real _absolute_tolerance;
+  const unsigned int _max_its;
+};
+
+#endif //SHEATHCREEPMODEL_H
@@ -0,0 +1,66 @@
+#!/usr/bin/env python
+"""
+Converts a CSV table of flux parameters into the binary format read by FissionHeatMaterial
+(flux_parameter_file = ...). See include/utils/FluxParameterData.h for the layout.
+
+The CSV needs a header naming the columns radius, enrichment, burnup, beta, kappa and lambda,
+with one row per (radius, enrichment, burnup) point. Radius is in metres, enrichment in percent
+and burnup in MWh/kgU. The grids may have any number of points, but every combination of
+radius, enrichment and burnup must be present exactly once.
+
+  ./flux_table_converter.py ../data/flux_parameters_builtin.csv flux_parameters.bin
+"""
+import sys, csv, struct, argparse
+
+MAGIC = b'CRBFLUX1'
+VERSION = 1
+COLUMNS = ['radius', 'enrichment', 'burnup', 'beta', 'kappa', 'lambda']
+
+def readTable(csv_name):
+  values = {}
+  with open(csv_name) as csv_file:
+    reader = csv.DictReader(row for row in csv_file if not row.lstrip().startswith('#'))
+    missing = [c for c in COLUMNS if c not in (reader.fieldnames or [])]
+    if missing:
+      sys.exit('%s is missing the column(s): %s' % (csv_name, ', '.join(missing)))
+
+    for line, row in enumerate(reader, 2):
+      key = (float(row['radius']), float(row['enrichment']), float(row['burnup']))
+      if key in values:
+        sys.exit('%s:%d repeats radius %g, enrichment %g, burnup %g' % ((csv_name, line) + key))
+      values[key] = (float(row['beta']), float(row['kappa']), float(row['lambda']))
+  return values
+
+def writeTable(values, bin_name):
+  radii = sorted(set(k[0] for k in values))
+  enrichments = sorted(set(k[1] for k in values))
+  burnups = sorted(set(k[2] for k in values))
+
+  for name, grid in (('radius', radii), ('enrichment', enrichments), ('burnup', burnups)):
+    if len(grid) < 2:
+      sys.exit('The %s grid needs at least two values' % name)
+
+  expected = len(radii) * len(enrichments) * len(burnups)
+  if len(values) != expected:
+    sys.exit('The table has %d rows but the grids need %d, some (radius, enrichment, burnup) points are missing' % (len(values), expected))
+
+  with open(bin_name, 'wb') as bin_file:
+    bin_file.write(MAGIC)
+    bin_file.write(struct.pack('=6I', VERSION, len(radii), len(enrichments), len(burnups), 0, 0))
+    for grid in (radii, enrichments, burnups):
+      bin_file.write(struct.pack('=%dd' % len(grid), *grid))
+
+    # Each table is stored as [radius][burnup][enrichment]
+    for column in range(3):
+      table = [values[(r, e, b)][column] for r in radii for b in burnups for e in enrichments]
+      bin_file.write(struct.pack('=%dd' % len(table), *table))
+
+  print('Wrote %s: %d radii, %d enrichments, %d burnups' % (bin_name, len(radii), len(enrichments), len(burnups)))
+
+if __name__ == '__main__':
+  parser = argparse.ArgumentParser(description='Convert a CSV flux parameter table into a binary flux_parameter_file')
+  parser.add_argument('csv_file', help='CSV with radius, enrichment, burnup, beta, kappa and lambda columns')
+  parser.add_argument('bin_file', help='Binary file to write')
+  args = parser.parse_args()
+
+  writeTable(readTable(args.csv_file), args.bin_file)
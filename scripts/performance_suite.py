@@ -0,0 +1,202 @@
+#!/usr/bin/env python
+"""
+Runs reduced-length versions of the shipped 2D, 3D and thesis decks (tests/performance/suite.json)
+and checks them against stored baselines (tests/performance/baselines.json).
+
+For every case it records the wall time, the number of time steps, nonlinear and linear iterations,
+residual evaluations (from the perf log) and the peak resident memory of the run. The results go to
+a JSON report, and a case that is slower or needs more iterations than its baseline allows for is
+reported as a regression, which makes the script exit with a non-zero status. So does a case without
+a baseline, unless --allow-missing is given.
+
+  ./performance_suite.py                          # run every case against the baselines
+  ./performance_suite.py --cases CANDU_1 --repeat 3
+  ./performance_suite.py --update-baselines       # record new baselines on the reference machine
+  ./performance_suite.py --allow-missing          # report cases without a baseline instead of failing on them
+"""
+import sys, os, re, json, time, socket, argparse, subprocess
+
+ROOT_DIR = os.path.abspath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+SUITE_DIR = os.path.join(ROOT_DIR, 'tests', 'performance')
+
+METRICS = ['wall_time', 'time_steps', 'nonlinear_iterations', 'linear_iterations', 'residual_evaluations', 'peak_rss_mb']
+
+NONLINEAR_RE = re.compile(r'^\s*(\d+)\s+Nonlinear \|R\| =', re.MULTILINE)
+LINEAR_RE = re.compile(r'^\s*(\d+)\s+Linear \|R\| =', re.MULTILINE)
+TIME_STEP_RE = re.compile(r'^Time Step\s+(\d+)', re.MULTILINE)
+RESIDUAL_RE = re.compile(r'\|\s*compute_residual\(\)\s*\|\s*(\d+)')
+
+def loadJson(file_name):
+  with open(file_name) as json_file:
+    return json.load(json_file)
+
+def writeJson(data, file_name):
+  with open(file_name, 'w') as json_file:
+    json.dump(data, json_file, indent=2, sort_keys=True)
+    json_file.write('\n')
+
+def gitRevision():
+  try:
+    return subprocess.check_output(['git', 'rev-parse', 'HEAD'], cwd=ROOT_DIR).decode().strip()
+  except (OSError, subprocess.CalledProcessError):
+    return None
+
+def parseOutput(output):
+  """ Iteration counts from the console output, the zeroth residual of each solve is not an iteration """
+  steps = TIME_STEP_RE.findall(output)
+  residuals = [int(calls) for calls in RESIDUAL_RE.findall(output)]
+  return {
+    'time_steps': max([int(step) for step in steps]) if steps else 0,
+    'nonlinear_iterations': len([it for it in NONLINEAR_RE.findall(output) if int(it) > 0]),
+    'linear_iterations': len([it for it in LINEAR_RE.findall(output) if int(it) > 0]),
+    'residual_evaluations': max(residuals) if residuals else None,
+  }
+
+def runCase(case, common_args, executable, mpi_command, log_dir):
+  """ Runs one case and returns its metrics, or None (with the log kept) if the run failed """
+  command = mpi_command + [executable, '-i', case['input']] + common_args + case.get('args', [])
+
+  log_name = os.path.join(log_dir, case['name'] + '.log')
+  with open(log_name, 'w') as log:
+    start = time.time()
+    process = subprocess.Popen(command, cwd=ROOT_DIR, stdout=log, stderr=subprocess.STDOUT)
+    # wait4 gives the resource usage of this run alone (peak RSS is reported in kB on Linux)
+    status, usage = os.wait4(process.pid, 0)[1:]
+    wall_time = time.time() - start
+    process.returncode = os.WEXITSTATUS(status) if os.WIFEXITED(status) else -os.WTERMSIG(status)
+
+  if process.returncode != 0:
+    print('  %s failed (status %d), see %s' % (case['name'], process.returncode, log_name))
+    return None
+
+  with open(log_name) as log:
+    metrics = parseOutput(log.read())
+  metrics['wall_time'] = wall_time
+  metrics['peak_rss_mb'] = usage.ru_maxrss / 1024.
+  return metrics
+
+def bestOf(runs):
+  """ Timings are noisy, so repeated runs keep the fastest time and the smallest memory; the counts should not change """
+  best = dict(runs[0])
+  for run in runs[1:]:
+    for metric in ['wall_time', 'peak_rss_mb']:
+      best[metric] = min(best[metric], run[metric])
+  return best
+
+def compare(metrics, baseline, tolerances):
+  """ Returns the list of metrics that grew past their tolerance, and a note for each one that improved on it """
+  regressions = []
+  improvements = []
+  for metric, tolerance in sorted(tolerances.items()):
+    value = metrics.get(metric)
+    reference = baseline.get(metric)
+    if value is None or reference is None:
+      continue
+
+    allowed = reference * (1 + tolerance.get('relative', 0)) + tolerance.get('absolute', 0)
+    if value > allowed:
+      regressions.append('%s %.4g > %.4g (baseline %.4g)' % (metric, value, allowed, reference))
+    elif value < reference * (1 - tolerance.get('relative', 0)) - tolerance.get('absolute', 0):
+      improvements.append('%s %.4g < baseline %.4g' % (metric, value, reference))
+  return regressions, improvements
+
+def main():
+  parser = argparse.ArgumentParser(description='Performance regression suite over the shipped input decks')
+  parser.add_argument('--executable', default=os.path.join(ROOT_DIR, 'caribou-opt'), help='Caribou executable (default: caribou-opt in the repository root)')
+  parser.add_argument('--suite', default=os.path.join(SUITE_DIR, 'suite.json'), help='Case list and tolerances')
+  parser.add_argument('--baselines', default=os.path.join(SUITE_DIR, 'baselines.json'), help='Stored baselines')
+  parser.add_argument('--report', default='performance_report.json', help='JSON report to write')
+  parser.add_argument('--log-dir', default='performance_logs', help='Directory for the console output of each run')
+  parser.add_argument('--cases', nargs='+', help='Only run the named cases')
+  parser.add_argument('--repeat', type=int, default=1, help='Run each case this many times and keep the best timing')
+  parser.add_argument('--mpi', type=int, default=0, help='Run with mpiexec -n MPI (default: serial)')
+  parser.add_argument('--update-baselines', action='store_true', help='Store the results as the new baselines instead of comparing')
+  parser.add_argument('--allow-missing', action='store_true', help='Do not fail on cases that have no baseline yet')
+  args = parser.parse_args()
+
+  if not os.path.isfile(args.executable):
+    sys.exit('Cannot find the Caribou executable %s, build it first or pass --executable' % args.executable)
+  if args.repeat < 1:
+    sys.exit('--repeat needs to be at least 1')
+
+  suite = loadJson(args.suite)
+  baselines = loadJson(args.baselines) if os.path.isfile(args.baselines) else {'cases': {}}
+
+  cases = suite['cases']
+  if args.cases:
+    unknown = set(args.cases) - set(case['name'] for case in cases)
+    if unknown:
+      sys.exit('Unknown case(s): %s' % ', '.join(sorted(unknown)))
+    cases = [case for case in cases if case['name'] in args.cases]
+
+  mpi_command = ['mpiexec', '-n', str(args.mpi)] if args.mpi > 0 else []
+  if not os.path.isdir(args.log_dir):
+    os.makedirs(args.log_dir)
+
+  report = {
+    'host': socket.gethostname(),
+    'date': time.strftime('%Y-%m-%d %H:%M:%S'),
+    'revision': gitRevision(),
+    'executable': os.path.abspath(args.executable),
+    'mpi_processes': max(args.mpi, 1),
+    'cases': {},
+  }
+  failed = False
+
+  for case in cases:
+    print('%s: %s' % (case['name'], case['input']))
+    runs = []
+    for i in range(args.repeat):
+      metrics = runCase(case, suite.get('common_args', []), os.path.abspath(args.executable), mpi_command, args.log_dir)
+      if metrics is None:
+        break
+      runs.append(metrics)
+
+    if len(runs) < args.repeat:
+      report['cases'][case['name']] = {'status': 'failed'}
+      failed = True
+      continue
+
+    metrics = bestOf(runs)
+    result = {'metrics': metrics}
+    print('  ' + ', '.join('%s %s' % (metric, '%.4g' % metrics[metric] if metrics[metric] is not None else '-') for metric in METRICS))
+
+    baseline = baselines['cases'].get(case['name'])
+    if args.update_baselines:
+      baselines['cases'][case['name']] = metrics
+      result['status'] = 'baseline updated'
+    elif baseline is None:
+      result['status'] = 'no baseline'
+      if args.allow_missing:
+        print('  no baseline')
+      else:
+        print('  NO BASELINE, record one with --update-baselines or pass --allow-missing')
+        failed = True
+    else:
+      regressions, improvements = compare(metrics, baseline, suite.get('tolerances', {}))
+      result['baseline'] = baseline
+      result['regressions'] = regressions
+      result['improvements'] = improvements
+      result['status'] = 'regression' if regressions else 'ok'
+      failed = failed or bool(regressions)
+
+      for line in regressions:
+        print('  REGRESSION ' + line)
+      for line in improvements:
+        print('  improved ' + line + ', consider --update-baselines')
+
+    report['cases'][case['name']] = result
+
+  writeJson(report, args.report)
+  print('Wrote %s' % args.report)
+
+  if args.update_baselines:
+    baselines['host'] = report['host']
+    baselines['revision'] = report['revision']
+    writeJson(baselines, args.baselines)
+    print('Updated %s' % args.baselines)
+
+  return 1 if failed else 0
+
+if __name__ == '__main__':
+  sys.exit(main())
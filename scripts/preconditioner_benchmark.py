@@ -0,0 +1,103 @@
+#!/usr/bin/env python
+"""
+Compares the preconditioners of the endcap decks: the Executioner's hypre BoomerAMG on the SMP
+matrix the decks ship with against the temperature / displacement field split
+(the split block of their [Preconditioning]).
+
+Every case of tests/performance/suite.json that is named is run once per preconditioner with the
+same reduced length, and the linear iterations (total and per nonlinear iteration), nonlinear
+iterations and time to solution are tabulated and written to a JSON report.
+
+  ./preconditioner_benchmark.py
+  ./preconditioner_benchmark.py --cases 3D_endcap --mpi 4 --repeat 3
+"""
+import sys, os, time, socket, argparse
+
+from performance_suite import ROOT_DIR, SUITE_DIR, loadJson, writeJson, gitRevision, runCase, bestOf
+
+# the field split sets the top level -pc_type itself, so the Executioner only keeps the GMRES restart
+PRECONDITIONERS = [
+  ('smp', []),
+  ('split', ['Preconditioning/active=split',
+             'Executioner/petsc_options_iname=-ksp_gmres_restart',
+             'Executioner/petsc_options_value=201']),
+]
+
+def main():
+  parser = argparse.ArgumentParser(description='Linear iterations and time to solution of the SMP and field split preconditioners')
+  parser.add_argument('--executable', default=os.path.join(ROOT_DIR, 'caribou-opt'), help='Caribou executable (default: caribou-opt in the repository root)')
+  parser.add_argument('--cases', nargs='+', default=['2D_springEndcap', '3D_endcap'], help='Cases of the performance suite to run')
+  parser.add_argument('--repeat', type=int, default=1, help='Run each case this many times and keep the best timing')
+  parser.add_argument('--mpi', type=int, default=0, help='Run with mpiexec -n MPI (default: serial)')
+  parser.add_argument('--report', default='preconditioner_report.json', help='JSON report to write')
+  parser.add_argument('--log-dir', default='preconditioner_logs', help='Directory for the console output of each run')
+  args = parser.parse_args()
+
+  if not os.path.isfile(args.executable):
+    sys.exit('Cannot find the Caribou executable %s, build it first or pass --executable' % args.executable)
+  if args.repeat < 1:
+    sys.exit('--repeat needs to be at least 1')
+
+  suite = loadJson(os.path.join(SUITE_DIR, 'suite.json'))
+  cases = dict((case['name'], case) for case in suite['cases'])
+  for name in args.cases:
+    if name not in cases:
+      sys.exit('There is no case %s in the performance suite' % name)
+
+  mpi_command = ['mpiexec', '-n', str(args.mpi)] if args.mpi > 0 else []
+  if not os.path.isdir(args.log_dir):
+    os.makedirs(args.log_dir)
+
+  report = {
+    'host': socket.gethostname(),
+    'date': time.strftime('%Y-%m-%d %H:%M:%S'),
+    'revision': gitRevision(),
+    'executable': os.path.abspath(args.executable),
+    'mpi': args.mpi,
+    'cases': {},
+  }
+  failed = False
+
+  for name in args.cases:
+    report['cases'][name] = {}
+    for preconditioner, preconditioner_args in PRECONDITIONERS:
+      print('%s: %s' % (name, preconditioner))
+      case = dict(cases[name])
+      case['name'] = '%s_%s' % (name, preconditioner)
+      case['args'] = case.get('args', []) + preconditioner_args
+
+      runs = []
+      for i in range(args.repeat):
+        metrics = runCase(case, suite.get('common_args', []), os.path.abspath(args.executable), mpi_command, args.log_dir)
+        if metrics is None:
+          break
+        runs.append(metrics)
+
+      if len(runs) < args.repeat:
+        report['cases'][name][preconditioner] = {'status': 'failed'}
+        failed = True
+        continue
+
+      metrics = bestOf(runs)
+      if metrics['nonlinear_iterations']:
+        metrics['linear_per_nonlinear'] = float(metrics['linear_iterations']) / metrics['nonlinear_iterations']
+      report['cases'][name][preconditioner] = {'status': 'ok', 'metrics': metrics}
+
+  print('\n%-16s %-6s %8s %10s %10s %12s %12s' % ('case', 'pc', 'steps', 'nonlinear', 'linear', 'lin/nonlin', 'wall [s]'))
+  for name in args.cases:
+    for preconditioner, preconditioner_args in PRECONDITIONERS:
+      result = report['cases'][name][preconditioner]
+      if result['status'] != 'ok':
+        print('%-16s %-6s %s' % (name, preconditioner, 'failed'))
+        continue
+      metrics = result['metrics']
+      print('%-16s %-6s %8d %10d %10d %12s %12.2f' % (name, preconditioner, metrics['time_steps'], metrics['nonlinear_iterations'],
+            metrics['linear_iterations'], '%.1f' % metrics['linear_per_nonlinear'] if 'linear_per_nonlinear' in metrics else '-',
+            metrics['wall_time']))
+
+  writeJson(report, args.report)
+  print('Wrote %s' % args.report)
+  return 1 if failed else 0
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,124 @@
+#!/usr/bin/env python
+"""
+Strong scaling of Caribou over MPI processes and threads, on the 3D endcap deck by default.
+
+The same reduced-length run is repeated for every layout of processes x threads, and the wall time,
+speedup and parallel efficiency (both relative to the 1x1 run) are tabulated and written to a JSON
+report. By default every layout with a power of two number of processes and threads that fits in
+--cores is run, from 1x1 up to cores x 1 and 1 x cores, so the best layout of a node can be read off.
+
+  ./scaling_benchmark.py --cores 16
+  ./scaling_benchmark.py --layouts 1x1 4x1 4x4 16x1 --repeat 3
+  ./scaling_benchmark.py --input 2D_Input_Files/2D_springEndcap_v5.i --args Executioner/num_steps=15
+"""
+import sys, os, time, socket, argparse
+
+from performance_suite import ROOT_DIR, loadJson, writeJson, gitRevision, runCase, bestOf
+
+SUITE = os.path.join(ROOT_DIR, 'tests', 'performance', 'suite.json')
+
+def defaultLayouts(cores):
+  layouts = []
+  processes = 1
+  while processes <= cores:
+    threads = 1
+    while processes * threads <= cores:
+      layouts.append((processes, threads))
+      threads *= 2
+    processes *= 2
+  return layouts
+
+def parseLayout(text):
+  try:
+    processes, threads = [int(n) for n in text.lower().split('x')]
+  except ValueError:
+    sys.exit('Layout %s is not of the form PROCESSESxTHREADS' % text)
+  if processes < 1 or threads < 1:
+    sys.exit('Layout %s needs at least one process and one thread' % text)
+  return (processes, threads)
+
+def main():
+  parser = argparse.ArgumentParser(description='Strong scaling over MPI processes x threads')
+  parser.add_argument('--executable', default=os.path.join(ROOT_DIR, 'caribou-opt'), help='Caribou executable (default: caribou-opt in the repository root)')
+  parser.add_argument('--input', default=os.path.join('3D_Input_Files', '3D_endcap_v2.i'), help='Deck to run, relative to the repository root')
+  parser.add_argument('--args', nargs='*', default=['Executioner/num_steps=5'], help='Extra command line arguments of every run')
+  parser.add_argument('--cores', type=int, default=8, help='Largest number of processes x threads for the default layouts')
+  parser.add_argument('--layouts', nargs='+', help='Layouts to run, e.g. 1x1 2x4 8x1 (processes x threads)')
+  parser.add_argument('--repeat', type=int, default=1, help='Run each layout this many times and keep the best timing')
+  parser.add_argument('--mpiexec', default='mpiexec', help='MPI launcher')
+  parser.add_argument('--report', default='scaling_report.json', help='JSON report to write')
+  parser.add_argument('--log-dir', default='scaling_logs', help='Directory for the console output of each run')
+  args = parser.parse_args()
+
+  if not os.path.isfile(args.executable):
+    sys.exit('Cannot find the Caribou executable %s, build it first or pass --executable' % args.executable)
+  if args.repeat < 1:
+    sys.exit('--repeat needs to be at least 1')
+
+  layouts = [parseLayout(layout) for layout in args.layouts] if args.layouts else defaultLayouts(args.cores)
+  if (1, 1) not in layouts:
+    layouts.insert(0, (1, 1))
+
+  # the same output settings as the regression suite, so the runs time the solve and not the I/O
+  common_args = loadJson(SUITE).get('common_args', [])
+  if not os.path.isdir(args.log_dir):
+    os.makedirs(args.log_dir)
+
+  report = {
+    'host': socket.gethostname(),
+    'date': time.strftime('%Y-%m-%d %H:%M:%S'),
+    'revision': gitRevision(),
+    'executable': os.path.abspath(args.executable),
+    'input': args.input,
+    'args': args.args,
+    'layouts': {},
+  }
+  failed = False
+
+  for processes, threads in layouts:
+    name = '%dx%d' % (processes, threads)
+    print('%s: %d processes x %d threads' % (name, processes, threads))
+
+    case = {'name': name, 'input': args.input, 'args': args.args + ['--n-threads=%d' % threads]}
+    mpi_command = [args.mpiexec, '-n', str(processes)] if processes > 1 else []
+
+    runs = []
+    for i in range(args.repeat):
+      metrics = runCase(case, common_args, os.path.abspath(args.executable), mpi_command, args.log_dir)
+      if metrics is None:
+        break
+      runs.append(metrics)
+
+    if len(runs) < args.repeat:
+      report['layouts'][name] = {'status': 'failed'}
+      failed = True
+      continue
+
+    metrics = bestOf(runs)
+    metrics.update({'processes': processes, 'threads': threads})
+    report['layouts'][name] = {'status': 'ok', 'metrics': metrics}
+
+  serial = report['layouts'].get('1x1', {}).get('metrics')
+  print('\n%8s %6s %8s %12s %10s %8s %12s' % ('layout', 'cores', 'steps', 'wall [s]', 'speedup', 'eff [%]', 'linear its'))
+  for processes, threads in layouts:
+    name = '%dx%d' % (processes, threads)
+    result = report['layouts'][name]
+    if result['status'] != 'ok':
+      print('%8s %6d %s' % (name, processes * threads, 'failed'))
+      continue
+
+    metrics = result['metrics']
+    if serial:
+      metrics['speedup'] = serial['wall_time'] / metrics['wall_time']
+      metrics['efficiency'] = metrics['speedup'] / (processes * threads)
+    # the linear iterations grow with the number of processes when the preconditioner is split up
+    print('%8s %6d %8d %12.2f %10s %8s %12d' % (name, processes * threads, metrics['time_steps'], metrics['wall_time'],
+          '%.2f' % metrics['speedup'] if serial else '-', '%.0f' % (100 * metrics['efficiency']) if serial else '-',
+          metrics['linear_iterations']))
+
+  writeJson(report, args.report)
+  print('Wrote %s' % args.report)
+  return 1 if failed else 0
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,135 @@
+#!/usr/bin/env python
+"""
+Compares the slice solver (slice/caribou-slice) with the full 2D-RZ model on the 2D_simple deck.
+
+Both models run the same power history. The 2D run is given two extra postprocessors on the command
+line, the peak pellet temperature and the average radial displacement of the sheath, and writes them
+to CSV. The slice run reports the centreline temperature and the sheath hoop strain directly. The
+slice results are interpolated to the 2D output times, and the differences are tabulated and checked
+against tolerances. The script exits with a non-zero status if either tolerance is exceeded.
+
+  ./slice_validation.py                                 # full 200 day history
+  ./slice_validation.py --end-time 8.64e5 --mpi 4       # first ten days only
+  ./slice_validation.py --slice-only                    # reuse the CSV of an earlier 2D run
+"""
+import sys, os, csv, argparse, subprocess
+
+ROOT_DIR = os.path.abspath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+
+DECK = os.path.join('2D_Input_Files', '2D_simple_v13.i')
+SLICE_INPUT = os.path.join(ROOT_DIR, 'slice', 'inputs', '2D_simple.slice')
+
+# the 2D deck has no postprocessors, these are added on the command line
+POSTPROCESSOR_ARGS = [
+  'Postprocessors/max_fuel_temp/type=ElementExtremeValue',
+  'Postprocessors/max_fuel_temp/variable=temp',
+  'Postprocessors/max_fuel_temp/block=pellets',
+  'Postprocessors/sheath_disp/type=ElementAverageValue',
+  'Postprocessors/sheath_disp/variable=disp_x',
+  'Postprocessors/sheath_disp/block=sheath',
+  'Outputs/csv=true',
+]
+
+def readCsv(file_name):
+  with open(file_name) as csv_file:
+    return [dict((key, float(value)) for key, value in row.items()) for row in csv.DictReader(csv_file)]
+
+def readSliceParameters(file_name):
+  """ The key = value pairs of a slice input """
+  parameters = {}
+  with open(file_name) as input_file:
+    for line in input_file:
+      line = line.split('#')[0].strip()
+      if '=' in line:
+        key, value = line.split('=', 1)
+        parameters[key.strip()] = value.strip()
+  return parameters
+
+def interpolate(times, values, t):
+  if t <= times[0]:
+    return values[0]
+  for i in range(1, len(times)):
+    if t <= times[i]:
+      weight = (t - times[i - 1]) / (times[i] - times[i - 1])
+      return values[i - 1] + weight * (values[i] - values[i - 1])
+  return values[-1]
+
+def runCommand(command, log_name):
+  print(' '.join(command))
+  with open(log_name, 'w') as log:
+    if subprocess.call(command, cwd=ROOT_DIR, stdout=log, stderr=subprocess.STDOUT) != 0:
+      sys.exit('The run failed, see %s' % log_name)
+
+def main():
+  parser = argparse.ArgumentParser(description='Validates the slice solver against the 2D_simple deck')
+  parser.add_argument('--executable', default=os.path.join(ROOT_DIR, 'caribou-opt'), help='Caribou executable')
+  parser.add_argument('--slice-executable', default=os.path.join(ROOT_DIR, 'slice', 'caribou-slice'), help='Slice solver executable')
+  parser.add_argument('--end-time', type=float, help='Shorten both runs to this end time [s]')
+  parser.add_argument('--mpi', type=int, default=0, help='Run the 2D model with mpiexec -n MPI')
+  parser.add_argument('--output-dir', default='slice_validation', help='Directory for the CSV files and logs')
+  parser.add_argument('--slice-only', action='store_true', help='Do not rerun the 2D model, use its CSV from the output directory')
+  parser.add_argument('--temp-tolerance', type=float, default=0.05, help='Largest relative difference of the centreline temperature rise over the coolant')
+  parser.add_argument('--strain-tolerance', type=float, default=5e-4, help='Largest absolute difference of the sheath hoop strain')
+  args = parser.parse_args()
+
+  for executable in [args.slice_executable] + ([] if args.slice_only else [args.executable]):
+    if not os.path.isfile(executable):
+      sys.exit('Cannot find %s, build it first or pass its path' % executable)
+
+  output_dir = os.path.abspath(args.output_dir)
+  if not os.path.isdir(output_dir):
+    os.makedirs(output_dir)
+
+  slice_parameters = readSliceParameters(SLICE_INPUT)
+  coolant_temp = float(slice_parameters.get('coolant_temperature', 550))
+  sheath_radius = 0.5 * (float(slice_parameters['sheath_inner_radius']) + float(slice_parameters['sheath_outer_radius']))
+
+  full_base = os.path.join(output_dir, '2D_simple')
+  if not args.slice_only:
+    command = (['mpiexec', '-n', str(args.mpi)] if args.mpi > 0 else []) + [args.executable, '-i', DECK, 'Outputs/file_base=' + full_base] + POSTPROCESSOR_ARGS
+    if args.end_time:
+      command.append('Executioner/end_time=%g' % args.end_time)
+    runCommand(command, full_base + '.log')
+
+  slice_csv = os.path.join(output_dir, '2D_simple_slice.csv')
+  command = [args.slice_executable, SLICE_INPUT, 'output=' + slice_csv]
+  if args.end_time:
+    command.append('end_time=%g' % args.end_time)
+  runCommand(command, os.path.join(output_dir, '2D_simple_slice.log'))
+
+  full = [row for row in readCsv(full_base + '.csv') if row['time'] > 0]
+  reduced = readCsv(slice_csv)
+
+  # the peak over the slices, to match the peak over the pellets
+  times = sorted(set(row['time'] for row in reduced))
+  centre = dict((t, max(row['centreline_temp'] for row in reduced if row['time'] == t)) for t in times)
+  hoop = dict((t, sum(row['sheath_hoop_strain'] for row in reduced if row['time'] == t) / len([row for row in reduced if row['time'] == t])) for t in times)
+
+  print('\n%14s %12s %12s %8s %14s %14s %12s' % ('time [s]', 'T 2D [K]', 'T slice [K]', 'dT [%]', 'hoop 2D', 'hoop slice', 'difference'))
+  worst_temp = 0
+  worst_strain = 0
+  for row in full:
+    t = row['time']
+    temp = interpolate(times, [centre[time] for time in times], t)
+    strain = interpolate(times, [hoop[time] for time in times], t)
+    full_strain = row['sheath_disp'] / sheath_radius
+
+    # relative to the rise over the coolant, which is what the models compute
+    temp_error = abs(temp - row['max_fuel_temp']) / max(row['max_fuel_temp'] - coolant_temp, 1.0)
+    strain_error = abs(strain - full_strain)
+    worst_temp = max(worst_temp, temp_error)
+    worst_strain = max(worst_strain, strain_error)
+
+    print('%14.6g %12.2f %12.2f %8.2f %14.4e %14.4e %12.2e' % (t, row['max_fuel_temp'], temp, 100 * temp_error, full_strain, strain, strain_error))
+
+  print('\nLargest centreline temperature rise difference %.2f %% (tolerance %.2f %%)' % (100 * worst_temp, 100 * args.temp_tolerance))
+  print('Largest sheath hoop strain difference %.2e (tolerance %.2e)' % (worst_strain, args.strain_tolerance))
+
+  if worst_temp > args.temp_tolerance or worst_strain > args.strain_tolerance:
+    print('FAILED')
+    return 1
+  print('OK')
+  return 0
+
+if __name__ == '__main__':
+  sys.exit(main())
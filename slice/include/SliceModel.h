@@ -0,0 +1,154 @@
+#ifndef SLICEMODEL_H
+#define SLICEMODEL_H
+
+#include "PhysicsConfig.h"
+#include "FluxParameterTable.h"
+#include "SheathCreepModel.h"
+
+#include <ostream>
+#include <vector>
+
+class SliceParameters;
+
+/**
+ * Reduced order (1.5D) fuel element model for scoping power histories.
+ *
+ * The element is cut into axial slices. Each slice solves transient radial heat conduction through
+ * the pellet, the gap and the sheath with finite volumes, and generalized plane strain for the
+ * pellet (a free cylinder, whose surface moves with the area averaged thermal expansion, swelling
+ * and densification strain) and for the sheath (a tube under the gas, contact and coolant pressures,
+ * with thermal expansion and diffusional creep). The slices are coupled through the pressure of the
+ * fill gas, shared between their gaps and the plenum.
+ *
+ * Every correlation comes from include/physics, SheathCreepModel and the flux parameter tables, so
+ * the heat generation, conductivities, gap conductance, swelling, densification and creep are those
+ * of the full Caribou model. Each time step iterates the temperatures, the gap and the gas pressure
+ * to a fixed point. Contact is rigid on the pellet side, the pellet stays elastic and unstressed,
+ * and there is no axial heat flow or fission gas release.
+ */
+class SliceModel
+{
+public:
+  SliceModel(const SliceParameters & parameters);
+
+  /// Runs the power history, writing a CSV row per slice and time step
+  void run(std::ostream & out);
+
+  /// Number of time steps taken and of fixed point iterations over all of them
+  unsigned int steps() const { return _steps; }
+  unsigned int iterations() const { return _iterations; }
+
+protected:
+  /// State of one axial slice. The *_old values are those at the start of the time step.
+  struct Slice
+  {
+    Real shape;          //axial power shape factor
+    Real length;         //m
+
+    std::vector<Real> temp, temp_old;   //fuel cells followed by sheath cells [K]
+    std::vector<Real> q;                //W/m^3
+    std::vector<Real> burnup, burnup_old;
+    std::vector<Real> burnup_dt;
+    std::vector<Real> densification, densification_old;
+    std::vector<Real> gfp, gfp_old;
+    std::vector<Real> thermal_strain, thermal_strain_old;
+    std::vector<Real> conductivity;
+
+    Real average_burnup, average_burnup_old;
+    Real pellet_radius;       //deformed, m
+    Real sheath_radius;       //deformed inner radius, m
+    Real gap;                 //m
+    Real gap_conductance;     //W/(m^2 K)
+    Real contact_pressure;    //Pa
+    Real hoop_strain;         //total, at mid wall
+    Real creep_hoop, creep_hoop_old;
+    Real creep_axial, creep_axial_old;
+    Real creep_effective, creep_effective_old;
+  };
+
+  /// Linear power history [W/m] and coolant pressure [Pa] at time t
+  Real linearPower(const Real t) const;
+  Real coolantPressure(const Real t) const;
+
+  /// Solves one step, returns false if the fixed point iterations did not converge
+  bool solveStep(const Real t, const Real dt);
+
+  /// One fixed point update of a slice, returns the largest temperature change
+  Real updateSlice(Slice & slice, const Real t, const Real dt);
+
+  /// Fission heat of every fuel cell at the start of step burnup, normalized to the slice's linear power
+  void computeHeat(Slice & slice, const Real power);
+
+  /// Burnup, densification and swelling at the end of the step from the current temperatures
+  void updateFuelState(Slice & slice, const Real dt);
+
+  /// Pellet and sheath deformation, contact pressure, gap width and creep
+  void updateMechanics(Slice & slice, const Real t, const Real dt);
+
+  /// Assembles and solves the tridiagonal conduction system, returns the largest temperature change
+  Real solveTemperature(Slice & slice, const Real dt);
+
+  /// Fill gas pressure from the gap and plenum volumes and temperatures
+  Real gasPressure() const;
+
+  /// Moves the converged end of step values into the start of step values (or back when a step fails)
+  void commit(Slice & slice);
+  void restore(Slice & slice);
+
+  void write(std::ostream & out, const Real t) const;
+
+  //geometry and mesh
+  const Real _pellet_radius;
+  const Real _sheath_inner_radius;
+  const Real _sheath_outer_radius;
+  const unsigned int _n_fuel;
+  const unsigned int _n_sheath;
+  std::vector<Real> _faces;     //cell faces, fuel then sheath [m]
+  std::vector<Real> _centres;   //cell centres [m]
+  std::vector<Real> _areas;     //cell cross sections [m^2]
+
+  //materials
+  const Real _fuel_density;
+  const Real _sheath_density;
+  const Real _enrichment;
+  const Real _ratio;
+  const Real _initial_porosity;
+  const Real _initial_temperature;
+  const Real _poissons_ratio;
+  const Real _radiation_factor;
+  const Real _min_gap;
+  const bool _model_creep;
+  SheathCreepModel _creep_model;
+  FluxParameterTable _flux_table;
+
+  //boundary conditions and history
+  const Real _coolant_temperature;
+  const Real _coolant_htc;
+  const Real _coolant_pressure;
+  const Real _pressure_ramp_time;
+  std::vector<Real> _power_times;
+  std::vector<Real> _power_values;
+
+  //fill gas
+  const Real _plenum_volume;
+  const Real _plenum_temperature;
+  Real _gas_moles;      //p V / T of the fill gas, the gas constant cancels
+  Real _gas_pressure;
+
+  //time stepping
+  const Real _start_time;
+  const Real _end_time;
+  const Real _dt_initial;
+  const Real _dt_min;
+  const Real _dt_max;
+  const Real _growth_factor;
+  const Real _tolerance;
+  const unsigned int _max_its;
+
+  std::vector<Slice> _slices;
+
+  unsigned int _steps;
+  unsigned int _iterations;
+};
+
+#endif //SLICEMODEL_H
@@ -0,0 +1,49 @@
+#ifndef SLICEPARAMETERS_H
+#define SLICEPARAMETERS_H
+
+#include "PhysicsConfig.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+/**
+ * Input of the slice solver: "key = value" lines, where # starts a comment and lists are separated
+ * by spaces. Command line arguments of the form key=value override the file. Every key has to be
+ * read by the solver, so misspelled keys are reported rather than silently ignored.
+ */
+class SliceParameters
+{
+public:
+  /// Reads a parameter file
+  void read(const std::string & file_name);
+
+  /// Sets one value from a key=value assignment
+  void set(const std::string & assignment);
+
+  /// Required number
+  Real get(const std::string & key) const;
+
+  /// Optional number
+  Real get(const std::string & key, const Real default_value) const;
+
+  /// Optional list, empty if the key is not given
+  std::vector<Real> getVector(const std::string & key) const;
+
+  bool getBool(const std::string & key, const bool default_value) const;
+
+  std::string getString(const std::string & key, const std::string & default_value) const;
+
+  /// Errors out on any key that was never read
+  void checkUnused() const;
+
+protected:
+  /// Records the key as read and returns its value, or NULL if it was not given
+  const std::string * find(const std::string & key) const;
+
+  std::map<std::string, std::string> _values;
+  mutable std::set<std::string> _used;
+};
+
+#endif //SLICEPARAMETERS_H
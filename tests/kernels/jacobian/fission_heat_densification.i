@@ -0,0 +1,161 @@
+# Checks the hand coded Jacobians of FissionHeatKernel (including the displacement coupling through
+# the density) and DensificationFractionKernel against finite differences
+[Problem]
+  coord_type = RZ
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmin = 1e-3
+  xmax = 6e-3
+  ymax = 1e-2
+  nx = 3
+  ny = 3
+[]
+
+[Variables]
+  [./temp]
+  [../]
+  [./densification_fraction]
+  [../]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+[]
+
+[AuxVariables]
+  [./burnup_avg]
+    order = CONSTANT
+    family = MONOMIAL
+    initial_condition = 200
+  [../]
+  [./burnup_dt]
+    initial_condition = 1e-3
+  [../]
+[]
+
+[Functions]
+  [./power]
+    type = ParsedFunction
+    value = 4e4
+  [../]
+  [./temp_ic]
+    type = ParsedFunction
+    value = '1100 + 2e4 * x + 1e4 * y'
+  [../]
+  [./densification_ic]
+    type = ParsedFunction
+    value = '0.1 + 10 * x * y'
+  [../]
+  [./disp_x_ic]
+    type = ParsedFunction
+    value = '2e-3 * x + 1e-3 * y'
+  [../]
+  [./disp_y_ic]
+    type = ParsedFunction
+    value = '-1e-3 * x + 3e-3 * y'
+  [../]
+[]
+
+[ICs]
+  [./temp]
+    type = FunctionIC
+    variable = temp
+    function = temp_ic
+  [../]
+  [./densification_fraction]
+    type = FunctionIC
+    variable = densification_fraction
+    function = densification_ic
+  [../]
+  [./disp_x]
+    type = FunctionIC
+    variable = disp_x
+    function = disp_x_ic
+  [../]
+  [./disp_y]
+    type = FunctionIC
+    variable = disp_y
+    function = disp_y_ic
+  [../]
+[]
+
+[Kernels]
+  [./heat]
+    type = HeatConduction
+    variable = temp
+  [../]
+  [./fission_heat]
+    type = FissionHeatKernel
+    variable = temp
+    disp_x = disp_x
+    disp_y = disp_y
+  [../]
+  [./densification_time]
+    type = TimeDerivative
+    variable = densification_fraction
+  [../]
+  [./densification]
+    type = DensificationFractionKernel
+    variable = densification_fraction
+    temp = temp
+    burnup_dt = burnup_dt
+    model_densification_fraction = true
+  [../]
+  [./disp_x]
+    type = Diffusion
+    variable = disp_x
+  [../]
+  [./disp_y]
+    type = Diffusion
+    variable = disp_y
+  [../]
+[]
+
+[Materials]
+  [./density]
+    type = Density
+    disp_r = disp_x
+    disp_z = disp_y
+    density = 1.065e4
+  [../]
+  [./conductivity]
+    type = HeatConductionMaterial
+    thermal_conductivity = 3
+    specific_heat = 300
+  [../]
+  [./fission_heat]
+    type = FissionHeatMaterial
+    linear_power = power
+    model_Qfission = true
+    burnup_avg = burnup_avg
+    enrichment = 1.0
+    pellet_radius = 6.075e-3
+    ratio = 0.925
+    initial_fuel_density = 1.065e4
+    initial_qfission = 0
+    initial_fuel_area = 1.159e-4
+    is_3D = false
+    model_plate_fuel = false
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  dt = 1
+  num_steps = 1
+[]
+
+[Outputs]
+  exodus = false
+[]
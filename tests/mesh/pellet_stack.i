@@ -0,0 +1,100 @@
+# Steady conduction on a generated pellet stack, with the boundary conditions on the sidesets the decks use
+# and the block volumes and sideset areas checked against the gold
+[Mesh]
+  type = PelletStackMesh
+  dim = 2
+  pellet_count = 2
+  dish_depth = 2e-4
+  dish_radius = 4e-3
+  endcap = top
+  endcap_gap = 1e-4
+  pellet_radial_elems = 4
+  pellet_radial_bias = 0.5
+  pellet_axial_elems = 3
+  azimuthal_elems = 4
+[]
+
+[Problem]
+  coord_type = RZ
+[]
+
+[Variables]
+  [./temp]
+    initial_condition = 550
+  [../]
+[]
+
+[Kernels]
+  [./conduction]
+    type = Diffusion
+    variable = temp
+  [../]
+[]
+
+[BCs]
+  [./centre]
+    type = DirichletBC
+    variable = temp
+    boundary = 'pellets_in pellet1_bot pellets_top'
+    value = 1500
+  [../]
+  [./coolant]
+    type = DirichletBC
+    variable = temp
+    boundary = 'sheath_out endcap_out sheath_IN endcap_bot'
+    value = 550
+  [../]
+[]
+
+[Postprocessors]
+  [./pellets_volume]
+    type = VolumePostprocessor
+    block = pellets
+  [../]
+  [./sheath_volume]
+    type = VolumePostprocessor
+    block = sheath
+  [../]
+  [./endcap_volume]
+    type = VolumePostprocessor
+    block = endcap
+  [../]
+  [./pellets_out_area]
+    type = AreaPostprocessor
+    boundary = pellets_out
+  [../]
+  [./pellet1_bot_area]
+    type = AreaPostprocessor
+    boundary = pellet1_bot
+  [../]
+  [./pellets_top_area]
+    type = AreaPostprocessor
+    boundary = pellets_top
+  [../]
+  [./sheath_IN_area]
+    type = AreaPostprocessor
+    boundary = sheath_IN
+  [../]
+  [./sheath_out_area]
+    type = AreaPostprocessor
+    boundary = sheath_out
+  [../]
+  [./endcap_out_area]
+    type = AreaPostprocessor
+    boundary = endcap_out
+  [../]
+  [./endcap_bot_area]
+    type = AreaPostprocessor
+    boundary = endcap_bot
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  output_initial = false
+  exodus = true
+  csv = true
+[]
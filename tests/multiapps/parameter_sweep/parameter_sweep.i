@@ -0,0 +1,47 @@
+# Runs sweep_sub.i once per row of sweep.txt and collects the average of its solution with
+# SweepResults. The sub-app is a linear steady profile between two Dirichlet values, so the average
+# is exactly the mean of the two swept values
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Variables]
+  [./dummy]
+  [../]
+[]
+
+[MultiApps]
+  [./sweep]
+    type = ParameterSweepMultiApp
+    app_type = CaribouApp
+    execute_on = timestep
+    input_files = sweep_sub.i
+    parameter_file = sweep.txt
+  [../]
+[]
+
+[UserObjects]
+  [./results]
+    type = SweepResults
+    multi_app = sweep
+    postprocessors = u_average
+    file = parameter_sweep_out_results.csv
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1
+  num_steps = 2
+[]
+
+[Outputs]
+  exodus = false
+[]
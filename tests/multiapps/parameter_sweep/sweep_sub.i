@@ -0,0 +1,53 @@
+# Linear profile between BCs/left/value and BCs/right/value, which the sweep overrides
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diffusion]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./u_average]
+    type = ElementAverageValue
+    variable = u
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  dt = 1
+  num_steps = 10
+[]
+
+[Outputs]
+  exodus = false
+[]
@@ -0,0 +1,264 @@
+# Runs the Caribou materials, kernels, aux kernels and user objects on a small pellet and sheath with
+# several threads, including the diagnostics and hot path counters they write into
+[Problem]
+  coord_type = RZ
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmin = 0
+  xmax = 6.5e-3
+  ymax = 1e-2
+  nx = 13
+  ny = 8
+[]
+
+[MeshModifiers]
+  [./sheath]
+    type = SubdomainBoundingBox
+    bottom_left = '6e-3 0 0'
+    top_right = '6.5e-3 1e-2 0'
+    block_id = 2
+  [../]
+[]
+
+[Variables]
+  [./temp]
+    initial_condition = 550
+  [../]
+  [./densification_fraction]
+    block = 0
+  [../]
+[]
+
+[AuxVariables]
+  [./burnup]
+    order = CONSTANT
+    family = MONOMIAL
+    block = 0
+  [../]
+  [./burnup_dt]
+    order = CONSTANT
+    family = MONOMIAL
+    block = 0
+  [../]
+  [./burnup_avg]
+    order = CONSTANT
+    family = MONOMIAL
+    block = 0
+  [../]
+  [./k_pellets]
+    order = FIRST
+    family = MONOMIAL
+    block = 0
+  [../]
+  [./k_sheath]
+    order = FIRST
+    family = MONOMIAL
+    block = 2
+  [../]
+  [./k_sheath_dT]
+    order = FIRST
+    family = MONOMIAL
+    block = 2
+  [../]
+[]
+
+[Functions]
+  [./power]
+    type = PiecewiseLinear
+    x = '0 2'
+    y = '0 43000'
+  [../]
+[]
+
+[UserObjects]
+  [./burnup]
+    type = BurnupUserObject
+    burnup = burnup
+    block = 0
+  [../]
+  [./power]
+    type = LinearPowerUserObject
+    linear_power = power
+    burnup_object = burnup
+    initial_fuel_density = 1.065e4
+    enrichment = 1.0
+    pellet_radius = 6e-3
+  [../]
+  [./hot_paths]
+    type = HotPathLog
+  [../]
+  [./diagnostics]
+    type = DiagnosticsWriter
+    file_base = caribou_objects_diagnostics
+  [../]
+[]
+
+[AuxKernels]
+  [./burnup]
+    type = BurnupFieldAux
+    variable = burnup
+    burnup_object = burnup
+    quantity = burnup
+    block = 0
+  [../]
+  [./burnup_dt]
+    type = BurnupFieldAux
+    variable = burnup_dt
+    burnup_object = burnup
+    quantity = burnup_dt
+    block = 0
+  [../]
+  [./burnup_avg]
+    type = BurnupFieldAux
+    variable = burnup_avg
+    burnup_object = burnup
+    quantity = average_burnup
+    block = 0
+  [../]
+  [./k_pellets]
+    type = ThermalConductivityPelletsAux
+    variable = k_pellets
+    temp = temp
+    burnup = burnup
+    model_k = true
+    block = 0
+  [../]
+  [./k_sheath]
+    type = ThermalConductivitySheathAux
+    variable = k_sheath
+    temp = temp
+    model_k = true
+    block = 2
+  [../]
+  [./k_sheath_dT]
+    type = ThermalConductivity_dTSheathAux
+    variable = k_sheath_dT
+    temp = temp
+    model_k_dT = true
+    block = 2
+  [../]
+[]
+
+[Kernels]
+  [./heat]
+    type = HeatConduction
+    variable = temp
+  [../]
+  [./heat_time]
+    type = HeatConductionTimeDerivative
+    variable = temp
+  [../]
+  [./fission_heat]
+    type = FissionHeatKernel
+    variable = temp
+    block = 0
+  [../]
+  [./densification_time]
+    type = TimeDerivative
+    variable = densification_fraction
+    block = 0
+  [../]
+  [./densification]
+    type = DensificationFractionKernel
+    variable = densification_fraction
+    temp = temp
+    burnup_dt = burnup_dt
+    model_densification_fraction = true
+    block = 0
+  [../]
+[]
+
+[BCs]
+  [./coolant]
+    type = DirichletBC
+    variable = temp
+    boundary = right
+    value = 550
+  [../]
+[]
+
+[Materials]
+  # integrated at each quadrature point alongside the densification_fraction variable the pellet material couples
+  [./densification]
+    type = DensificationMaterial
+    block = 0
+    temp = temp
+    burnup_dt = burnup_dt
+  [../]
+  [./pellet_thermal]
+    type = PelletThermalMaterial
+    block = 0
+    temp = temp
+    burnup = burnup
+    burnup_dt = burnup_dt
+    densification_fraction = densification_fraction
+    initial_porosity = 0.0286
+    model_thermal_conductivity = true
+    model_specific_heat = true
+    model_porosity = true
+    model_alpha = true
+    model_SFP = true
+    model_GFP = true
+    display_values = true
+  [../]
+  [./sheath_thermal]
+    type = SheathThermalMaterial
+    block = 2
+    temp = temp
+    k_sheath = k_sheath
+    k_sheath_dT = k_sheath_dT
+    model_thermal_conductivity = true
+    model_specific_heat = true
+  [../]
+  [./density]
+    type = Density
+    density = 1.065e4
+  [../]
+  [./fission_heat]
+    type = FissionHeatMaterial
+    block = 0
+    power_object = power
+    model_Qfission = true
+    ratio = 0.925
+    initial_fuel_density = 1.065e4
+    initial_qfission = 0
+    initial_fuel_area = 1.131e-4
+    is_3D = false
+    model_plate_fuel = false
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  dt = 1
+  num_steps = 4
+[]
+
+[Postprocessors]
+  [./max_temp]
+    type = ElementExtremeValue
+    variable = temp
+  [../]
+  [./average_burnup]
+    type = ElementAverageValue
+    variable = burnup
+    block = 0
+  [../]
+[]
+
+[Outputs]
+  exodus = false
+  csv = true
+  print_perf_log = true
+[]
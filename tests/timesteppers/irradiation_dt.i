@@ -0,0 +1,149 @@
+# Ramps the linear power of a pellet from zero and holds it, the IrradiationDT steps are written to
+# the CSV file. The burnup and temperature limits are loose, so the steps only depend on the power
+# function: constant steps at the min_power floor, steps growing with the power up the ramp, and
+# doubling once the power is held
+[Problem]
+  coord_type = RZ
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmin = 0
+  xmax = 6e-3
+  ymax = 1e-2
+  nx = 6
+  ny = 2
+[]
+
+[Variables]
+  [./temp]
+    initial_condition = 550
+  [../]
+[]
+
+[AuxVariables]
+  [./burnup]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Functions]
+  [./power]
+    type = PiecewiseLinear
+    x = '0 9.3'
+    y = '0 41000'
+  [../]
+[]
+
+[UserObjects]
+  [./burnup]
+    type = BurnupUserObject
+    burnup = burnup
+  [../]
+[]
+
+[AuxKernels]
+  [./burnup]
+    type = BurnupFieldAux
+    variable = burnup
+    burnup_object = burnup
+    quantity = burnup
+  [../]
+[]
+
+[Kernels]
+  [./heat]
+    type = HeatConduction
+    variable = temp
+  [../]
+  [./heat_time]
+    type = HeatConductionTimeDerivative
+    variable = temp
+  [../]
+  [./fission_heat]
+    type = FissionHeatKernel
+    variable = temp
+  [../]
+[]
+
+[BCs]
+  [./coolant]
+    type = DirichletBC
+    variable = temp
+    boundary = right
+    value = 550
+  [../]
+[]
+
+[Materials]
+  [./thermal]
+    type = GenericConstantMaterial
+    prop_names = 'thermal_conductivity specific_heat density'
+    prop_values = '3 300 1.065e4'
+  [../]
+  [./fission_heat]
+    type = FissionHeatMaterial
+    linear_power = power
+    burnup_object = burnup
+    model_Qfission = true
+    enrichment = 1.0
+    pellet_radius = 6e-3
+    ratio = 0.925
+    initial_fuel_density = 1.065e4
+    initial_qfission = 0
+    initial_fuel_area = 1.131e-4
+    is_3D = false
+    model_plate_fuel = false
+  [../]
+[]
+
+[Postprocessors]
+  [./dt]
+    type = TimestepSize
+  [../]
+  [./max_temp]
+    type = ElementExtremeValue
+    variable = temp
+  [../]
+  [./average_burnup]
+    type = ElementAverageValue
+    variable = burnup
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  end_time = 1e4
+  num_steps = 20
+
+  # min_power defaults to a tenth of the 41 kW/m peak
+  [./TimeStepper]
+    type = IrradiationDT
+    dt = 1.3
+    growth_factor = 2
+    linear_power = power
+    max_power_change = 0.23
+    power_samples = 16
+    burnup = average_burnup
+    max_burnup_increment = 100
+    temperature = max_temp
+    max_temperature_change = 5000
+  [../]
+[]
+
+[Outputs]
+  output_initial = false
+  exodus = false
+  csv = true
+  hide = 'max_temp average_burnup'
+[]
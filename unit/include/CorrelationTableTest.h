@@ -0,0 +1,38 @@
+#ifndef CORRELATIONTABLETEST_H
+#define CORRELATIONTABLETEST_H
+
+// CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+#include "PhysicsConfig.h"
+
+#include <vector>
+
+class CorrelationTable;
+
+class CorrelationTableTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( CorrelationTableTest );
+
+  CPPUNIT_TEST( sheathPhaseBreakpoints );
+  CPPUNIT_TEST( sheathYoungsModulusBreakpoints );
+  CPPUNIT_TEST( sheathSpecificHeatBreakpoint );
+  CPPUNIT_TEST( pelletCorrelations );
+  CPPUNIT_TEST( checkModeMatches );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void sheathPhaseBreakpoints();
+  void sheathYoungsModulusBreakpoints();
+  void sheathSpecificHeatBreakpoint();
+  void pelletCorrelations();
+  void checkModeMatches();
+
+protected:
+  /// Asserts the tolerance over the whole table and on both sides of every breakpoint
+  void checkTable(const CorrelationTable & table, Real (*correlation)(const Real),
+                  const std::vector<Real> & breakpoints, const Real table_tolerance);
+};
+
+#endif // CORRELATIONTABLETEST_H
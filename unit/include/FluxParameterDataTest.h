@@ -0,0 +1,27 @@
+#ifndef FLUXPARAMETERDATATEST_H
+#define FLUXPARAMETERDATATEST_H
+
+// CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+class FluxParameterData;
+
+class FluxParameterDataTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( FluxParameterDataTest );
+
+  CPPUNIT_TEST( mappedMatchesBuiltin );
+  CPPUNIT_TEST( lookupsMatchBuiltin );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void mappedMatchesBuiltin();
+  void lookupsMatchBuiltin();
+
+protected:
+  /// The builtin CSV written through scripts/flux_table_converter.py and mapped back
+  static const FluxParameterData & converted();
+};
+
+#endif // FLUXPARAMETERDATATEST_H
@@ -0,0 +1,27 @@
+#ifndef RADIALPOWERPROFILETEST_H
+#define RADIALPOWERPROFILETEST_H
+
+// CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+class RadialPowerProfileTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( RadialPowerProfileTest );
+
+  CPPUNIT_TEST( besselFits );
+  CPPUNIT_TEST( batchMatchesScalar );
+  CPPUNIT_TEST( batchLargeArguments );
+  CPPUNIT_TEST( uniformMatchesScalar );
+  CPPUNIT_TEST( powerConservation );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void besselFits();
+  void batchMatchesScalar();
+  void batchLargeArguments();
+  void uniformMatchesScalar();
+  void powerConservation();
+};
+
+#endif // RADIALPOWERPROFILETEST_H